@@ -0,0 +1,15 @@
+-- Table: army_roster
+-- Each master's spawned bots, their role/spec overrides and the army's
+-- formation.  Rows are written as bots spawn and settings change, removed
+-- by `.army dismiss` / `.army dismissone`, and kept across master logout and
+-- server restart so the army is restored on the master's next login.
+
+CREATE TABLE IF NOT EXISTS `army_roster` (
+    `master_guid` INT UNSIGNED NOT NULL,                 -- characters.guid of the master
+    `bot_guid` INT UNSIGNED NOT NULL,                    -- characters.guid of the bot alt
+    `role_override` TINYINT UNSIGNED NOT NULL DEFAULT 255,   -- BotRole, 255 = detect from talents
+    `spec_override` TINYINT UNSIGNED NOT NULL DEFAULT 255,   -- rotation spec index, 255 = detect
+    `formation` TINYINT UNSIGNED NOT NULL DEFAULT 0,     -- 0 = arrow, 1 = line, 2 = follow
+    PRIMARY KEY (`master_guid`, `bot_guid`),
+    KEY `idx_bot` (`bot_guid`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COMMENT='Persisted bot armies for restore on login';
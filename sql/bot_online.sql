@@ -0,0 +1,11 @@
+-- Table: bot_online
+-- Ledger of alt characters currently spawned as bots.
+-- Rows are written in batches with the online flag; on startup any rows left
+-- over from a crash are used to clear stale `characters.online` flags.
+
+CREATE TABLE IF NOT EXISTS `bot_online` (
+    `guid` INT UNSIGNED NOT NULL,                -- Bot character GUID
+    `master_guid` INT UNSIGNED NOT NULL,         -- Master who spawned it
+    PRIMARY KEY (`guid`),
+    KEY `idx_master_guid` (`master_guid`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COMMENT='Live bot characters (crash reconciliation ledger)';
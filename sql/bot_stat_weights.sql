@@ -0,0 +1,52 @@
+-- Table: bot_stat_weights
+-- Per-spec stat weights for bot auto-equip, keyed like bot_rotations.
+-- A spec without a row falls back to its role's built-in defaults.
+--
+-- Score = sum(stat * weight) + armor * armor + weapon DPS * melee/ranged_dps
+--         + sockets * socket.  Armor below the class's best type and
+--         weapons outside `weapon_mask` are penalised.
+-- `weapon_mask` is a bitmask of (1 << ITEM_SUBCLASS_WEAPON_*); 0 = any.
+-- To change weights: UPDATE the row, then `.rpg reload` in-game.
+
+DROP TABLE IF EXISTS `bot_stat_weights`;
+CREATE TABLE `bot_stat_weights` (
+    `class_id`          TINYINT UNSIGNED NOT NULL  COMMENT '1=War 2=Pal 3=Hunt 4=Rog 5=Pri 6=DK 7=Sha 8=Mag 9=Lock 11=Dru',
+    `spec_index`        TINYINT UNSIGNED NOT NULL  COMMENT 'Talent tree 0/1/2',
+    `strength`          FLOAT NOT NULL DEFAULT 0,
+    `agility`           FLOAT NOT NULL DEFAULT 0,
+    `stamina`           FLOAT NOT NULL DEFAULT 0,
+    `intellect`         FLOAT NOT NULL DEFAULT 0,
+    `spirit`            FLOAT NOT NULL DEFAULT 0,
+    `attack_power`      FLOAT NOT NULL DEFAULT 0,
+    `spell_power`       FLOAT NOT NULL DEFAULT 0,
+    `hit_rating`        FLOAT NOT NULL DEFAULT 0,
+    `crit_rating`       FLOAT NOT NULL DEFAULT 0,
+    `haste_rating`      FLOAT NOT NULL DEFAULT 0,
+    `expertise_rating`  FLOAT NOT NULL DEFAULT 0,
+    `armor_pen_rating`  FLOAT NOT NULL DEFAULT 0,
+    `defense_rating`    FLOAT NOT NULL DEFAULT 0,
+    `dodge_rating`      FLOAT NOT NULL DEFAULT 0,
+    `parry_rating`      FLOAT NOT NULL DEFAULT 0,
+    `block_rating`      FLOAT NOT NULL DEFAULT 0,
+    `block_value`       FLOAT NOT NULL DEFAULT 0,
+    `mp5`               FLOAT NOT NULL DEFAULT 0,
+    `armor`             FLOAT NOT NULL DEFAULT 0,
+    `melee_dps`         FLOAT NOT NULL DEFAULT 0   COMMENT 'Per point of weapon DPS',
+    `ranged_dps`        FLOAT NOT NULL DEFAULT 0   COMMENT 'Per point of ranged weapon DPS',
+    `socket`            FLOAT NOT NULL DEFAULT 0   COMMENT 'Per gem socket',
+    `weapon_mask`       INT UNSIGNED NOT NULL DEFAULT 0,
+    `comment`           VARCHAR(64) DEFAULT NULL,
+    PRIMARY KEY (`class_id`, `spec_index`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COMMENT='Per-spec item stat weights for RPG bots';
+
+-- Specs the role defaults get wrong.  Hunters are ranged physical, not
+-- casters; feral druids ignore weapon DPS.
+INSERT INTO `bot_stat_weights`
+    (`class_id`, `spec_index`, `strength`, `agility`, `stamina`, `intellect`, `spirit`, `attack_power`, `spell_power`,
+     `hit_rating`, `crit_rating`, `haste_rating`, `expertise_rating`, `armor_pen_rating`,
+     `defense_rating`, `dodge_rating`, `parry_rating`, `block_rating`, `block_value`, `mp5`, `armor`,
+     `melee_dps`, `ranged_dps`, `socket`, `weapon_mask`, `comment`) VALUES
+(3,  0, 0,    1.0, 0.1, 0.2, 0, 0.5, 0, 0.8, 0.7, 0.5, 0,   0.5, 0,   0,   0, 0, 0, 0,   0,    0.1, 4.0, 8, 0, 'Hunter — Beast Mastery'),
+(3,  1, 0,    1.0, 0.1, 0.2, 0, 0.5, 0, 0.9, 0.7, 0.5, 0,   0.7, 0,   0,   0, 0, 0, 0,   0,    0.1, 4.0, 8, 0, 'Hunter — Marksmanship'),
+(3,  2, 0,    1.0, 0.1, 0.2, 0, 0.5, 0, 0.8, 0.7, 0.6, 0,   0.5, 0,   0,   0, 0, 0, 0,   0,    0.1, 4.0, 8, 0, 'Hunter — Survival'),
+(11, 1, 0.8,  1.0, 0.6, 0,   0, 0.5, 0, 0.7, 0.7, 0.3, 0.7, 0.6, 0.3, 0.5, 0, 0, 0, 0,   0.05, 0,   0,   8, 0, 'Druid — Feral Combat');
@@ -0,0 +1,13 @@
+-- Table: bot_talent_builds
+-- Named talent builds for `.army talent apply <name|all> <build>`.
+-- `build` uses the familiar calculator format: one digit per talent (rank),
+-- trees separated by '-', talents in row-then-column order; trailing zeros
+-- may be omitted.  Builds are validated against the talent DBCs on apply.
+
+CREATE TABLE IF NOT EXISTS `bot_talent_builds` (
+    `class_id` TINYINT UNSIGNED NOT NULL,        -- Class (1 = Warrior ... 11 = Druid)
+    `name` VARCHAR(32) NOT NULL,                 -- Build name used by the command
+    `build` VARCHAR(128) NOT NULL,               -- e.g. '3022032123331-05-0502'
+    `comment` TEXT DEFAULT NULL,
+    PRIMARY KEY (`class_id`, `name`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COMMENT='Named talent builds for RPG bots';
@@ -0,0 +1,25 @@
+-- Table: rpg_trait_modifiers
+-- Behaviour modifiers per temperament / psychology.  Compiled at login and on
+-- reroll into one per-character block the bot AI reads directly; traits
+-- without a row use the neutral defaults below.
+
+CREATE TABLE IF NOT EXISTS `rpg_trait_modifiers` (
+    `trait_kind` TINYINT UNSIGNED NOT NULL,                     -- 0 = rpg_temperaments, 1 = rpg_psychology
+    `trait_id` INT UNSIGNED NOT NULL,                           -- id in that table
+    `mechanics_mult` FLOAT NOT NULL DEFAULT 1,                  -- RollSuccess multiplier per stat
+    `rotation_mult` FLOAT NOT NULL DEFAULT 1,
+    `heroism_mult` FLOAT NOT NULL DEFAULT 1,
+    `mood_swing` FLOAT NOT NULL DEFAULT 0,                      -- ± fraction around the multiplier (0.5 = 0.5x-1.5x)
+    `roll_offset` FLOAT NOT NULL DEFAULT 0,                     -- % added after the multiplier
+    `reaction_delay_ms` INT UNSIGNED NOT NULL DEFAULT 0,        -- delay before engaging a new fight
+    `defensive_hp_offset` FLOAT NOT NULL DEFAULT 0,             -- added to the defensive HP% threshold
+    `heal_threshold_offset` FLOAT NOT NULL DEFAULT 0,           -- added to the healer HP% threshold
+    `comment` TEXT DEFAULT NULL,
+    PRIMARY KEY (`trait_kind`, `trait_id`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COMMENT='Temperament/psychology behaviour modifiers for RPG bots';
+
+-- Insane psychology swings 0.5x-1.5x.  Matched by name, so run this after
+-- rpg_psychology.sql; re-running leaves an edited row alone.
+INSERT IGNORE INTO `rpg_trait_modifiers` (`trait_kind`, `trait_id`, `mood_swing`, `comment`)
+SELECT 1, `id`, 0.5, 'Insane: high peaks of brilliance, deep valleys of failure'
+FROM `rpg_psychology` WHERE `name` = 'Insane';
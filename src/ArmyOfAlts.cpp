@@ -20,184 +20,33 @@
 #include "Random.h"
 #include "MotionMaster.h"
 #include "SocialMgr.h"
+#include "ArmyRoster.h"
 #include "BotAI.h"
+#include "BotHibernation.h"
+#include "BotLod.h"
 #include "BotBehavior.h"
+#include "BotDecisionTrace.h"
+#include "BotOnlineTracker.h"
+#include "BotProfiler.h"
+#include "BotSaveScheduler.h"
+#include "BotSessionSystem.h"
+#include "BotSpawnProcessor.h"
+#include "ProfileStore.h"
 #include "RPGBotsConfig.h"
 #include "RotationEngine.h"
 #include "SelfBotSystem.h"
+#include <algorithm>
 #include <cmath>
 
 using namespace Acore::ChatCommands;
 
-// ─── BotLoginQueryHolder ───────────────────────────────────────────────────────
-// Replicates the LoginQueryHolder from CharacterHandler.cpp (which is a local class)
-// so we can load a character's full data from outside the normal login flow.
-class BotLoginQueryHolder : public CharacterDatabaseQueryHolder
-{
-    uint32 m_accountId;
-    ObjectGuid m_guid;
-public:
-    BotLoginQueryHolder(uint32 accountId, ObjectGuid guid)
-        : m_accountId(accountId), m_guid(guid) {}
-
-    ObjectGuid GetGuid() const { return m_guid; }
-    uint32 GetAccountId() const { return m_accountId; }
-
-    bool Initialize()
-    {
-        SetSize(MAX_PLAYER_LOGIN_QUERY);
-        bool res = true;
-        ObjectGuid::LowType lowGuid = m_guid.GetCounter();
-
-        CharacterDatabasePreparedStatement* stmt = nullptr;
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_FROM, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_AURAS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_AURAS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_SPELL);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_SPELLS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_QUESTSTATUS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_QUEST_STATUS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_DAILYQUESTSTATUS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_DAILY_QUEST_STATUS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_WEEKLYQUESTSTATUS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_WEEKLY_QUEST_STATUS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_MONTHLYQUESTSTATUS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MONTHLY_QUEST_STATUS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_SEASONALQUESTSTATUS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_SEASONAL_QUEST_STATUS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_REPUTATION);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_REPUTATION, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_INVENTORY);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_INVENTORY, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_ACTIONS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_ACTIONS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAIL);
-        stmt->SetData(0, lowGuid);
-        stmt->SetData(1, uint32(GameTime::GetGameTime().count()));
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAILS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_SOCIALLIST);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_SOCIAL_LIST, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_HOMEBIND);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_HOME_BIND, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_SPELLCOOLDOWNS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_SPELL_COOLDOWNS, stmt);
-
-        if (sWorld->getBoolConfig(CONFIG_DECLINED_NAMES_USED))
-        {
-            stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_DECLINEDNAMES);
-            stmt->SetData(0, lowGuid);
-            res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_DECLINED_NAMES, stmt);
-        }
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_ACHIEVEMENTS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_ACHIEVEMENTS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_CRITERIAPROGRESS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_CRITERIA_PROGRESS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_EQUIPMENTSETS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_EQUIPMENT_SETS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_ENTRY_POINT);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_ENTRY_POINT, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_GLYPHS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_GLYPHS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_TALENTS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_TALENTS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PLAYER_ACCOUNT_DATA);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_ACCOUNT_DATA, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_SKILLS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_SKILLS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_RANDOMBG);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_RANDOM_BG, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_BANNED);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_BANNED, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_QUESTSTATUSREW);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_QUEST_STATUS_REW, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_BREW_OF_THE_MONTH);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_BREW_OF_THE_MONTH, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_ACCOUNT_INSTANCELOCKTIMES);
-        stmt->SetData(0, m_accountId);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_INSTANCE_LOCK_TIMES, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CORPSE_LOCATION);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_CORPSE_LOCATION, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_SETTINGS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_CHARACTER_SETTINGS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_PETS);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_PET_SLOTS, stmt);
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES);
-        stmt->SetData(0, lowGuid);
-        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_OFFLINE_ACHIEVEMENTS_UPDATES, stmt);
-
-        return res;
-    }
-};
-
 // ─── Dismiss a single bot ──────────────────────────────────────────────────────
-static void DismissOneBot(BotInfo& entry)
+// The final save is appended to the caller's transaction and the offline flag
+// is queued on the tracker; the caller flushes both in one batch.
+static void DismissOneBot(BotInfo& entry, CharacterDatabaseTransaction trans)
 {
+    RPGBOTS_PERF_SCOPE(PERF_DISMISS_BOT);
+
     Player* bot = entry.player;
     WorldSession* botSession = entry.session;
 
@@ -208,21 +57,22 @@ static void DismissOneBot(BotInfo& entry)
 
     ObjectGuid::LowType guidLow = bot->GetGUID().GetCounter();
 
+    // ── Save while the bot is still fully in the world ────────────────────
+    // Spell/talent load state was reset to UNCHANGED at spawn (see
+    // BotSaveScheduler::MarkLoadedStateClean), so this only writes deltas:
+    // loot, XP, money and any unsaved equip/talent changes.
+    sBotSaveScheduler.SaveInto(trans, bot);
+
+    // Bots skip the logout hook, so write back and evict their profile here
+    sProfileStore.Unload(guidLow);
+    sBotDecisionTrace.Release(guidLow);
+
     // ── Detach from group while fully valid ───────────────────────────────
     if (Group* group = bot->GetGroup())
         group->RemoveMember(bot->GetGUID());
 
-    // ── Mark offline ────────────────────────────────────────────────────
-    // We intentionally skip SaveToDB() here.  Bot characters are loaded
-    // without the core's m_playerLoading flag (it's private), so every
-    // spell/talent that was read from the DB is internally marked as
-    // PLAYERSPELL_NEW.  Calling SaveToDB() would try to INSERT rows that
-    // already exist and produce duplicate-key errors.
-    //
-    // Any intentional changes (talent fill, equip swaps, etc.) call
-    // SaveToDB() themselves at the point of change — so nothing is lost.
-    CharacterDatabase.Execute("UPDATE characters SET online = 0 WHERE guid = {}",
-                              guidLow);
+    // ── Mark offline (flushed into the same transaction, after the save) ──
+    sBotOnlineTracker.MarkOffline(guidLow);
 
     // ── Disconnect session from player FIRST ──────────────────────────────
     // Prevents any script hooks from accessing the session→player link
@@ -258,9 +108,9 @@ static void DismissOneBot(BotInfo& entry)
     // Remove from global GUID lookup
     ObjectAccessor::RemoveObject(bot);
 
-    // ── Delete ────────────────────────────────────────────────────────────
+    // ── Delete player, return session to the pool ─────────────────────────
     delete bot;
-    delete botSession;
+    sBotSessionPool.Release(botSession);
 
     entry.player = nullptr;
     entry.session = nullptr;
@@ -270,109 +120,48 @@ static void DismissOneBot(BotInfo& entry)
 static void DismissAllBots(ObjectGuid::LowType masterGuidLow)
 {
     auto bots = sBotMgr.RemoveAllBots(masterGuidLow);
+    sBotHibernation.Forget(masterGuidLow);
+    sBotLod.Forget(masterGuidLow);
+    if (bots.empty())
+        return;
+
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     for (auto& entry : bots)
-        DismissOneBot(entry);
+        DismissOneBot(entry, trans);
+    sBotOnlineTracker.FlushInto(trans);
+    CharacterDatabase.CommitTransaction(trans);
 }
 
-// ─── Bot spawn callback (runs after DB queries complete) ───────────────────────
-static void FinishBotSpawn(ObjectGuid masterGuid, WorldSession* botSession, ObjectGuid botGuid,
-                           CharacterDatabaseQueryHolder const& holder)
+// ─── Dismiss every army on the realm (shutdown) ───────────────────────────────
+// One synchronous transaction for all bots: saves, then one batched offline
+// update, so shutdown stays fast with thousands of bots.
+static uint32 DismissAllArmies()
 {
-    Player* master = ObjectAccessor::FindPlayer(masterGuid);
-    if (!master)
+    std::vector<ObjectGuid::LowType> masters;
+    masters.reserve(sBotMgr.GetAll().size());
+    for (auto const& [masterLow, bots] : sBotMgr.GetAll())
     {
-        LOG_ERROR("module", "RPGBots: Master player gone before bot spawn completed");
-        delete botSession;
-        return;
+        (void)bots;
+        masters.push_back(masterLow);
     }
 
-    // Create the bot Player object (this sets botSession->_player = bot)
-    Player* bot = new Player(botSession);
-
-    if (!bot->LoadFromDB(botGuid, holder))
-    {
-        LOG_ERROR("module", "RPGBots: Failed to load bot character {}", botGuid.ToString());
-        botSession->SetPlayer(nullptr);
-        delete bot;
-        delete botSession;
-        return;
-    }
-
-    bot->GetMotionMaster()->Initialize();
-
-    // Relocate bot near master with a random offset
-    float angle = frand(0.0f, 2.0f * float(M_PI));
-    float dist  = frand(2.0f, 5.0f);
-    float x = master->GetPositionX() + dist * std::cos(angle);
-    float y = master->GetPositionY() + dist * std::sin(angle);
-    float z = master->GetPositionZ();
-    float o = master->GetOrientation();
-
-    Map* masterMap = master->GetMap();
-
-    // Override bot's position and map to master's location
-    bot->Relocate(x, y, z, o);
-    bot->m_mapId = master->GetMapId();
-    bot->ResetMap();
-    bot->SetMap(masterMap);
-    bot->UpdatePositionData();
-
-    // Send initial packets (no-op for null socket, but may set internal state)
-    bot->SendInitialPacketsBeforeAddToMap();
-
-    // Register in global hash maps so FindPlayer() works
-    ObjectAccessor::AddObject(bot);
+    if (masters.empty())
+        return 0;
 
-    // Add to map grid — this calls AddToWorld() and makes the bot visible
-    if (!masterMap->AddPlayerToMap(bot))
+    uint32 count = 0;
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    for (ObjectGuid::LowType masterLow : masters)
     {
-        LOG_ERROR("module", "RPGBots: Failed to add bot {} to map", bot->GetName());
-        ObjectAccessor::RemoveObject(bot);
-        botSession->SetPlayer(nullptr);
-        delete bot;
-        delete botSession;
-        return;
-    }
-
-    bot->SendInitialPacketsAfterAddToMap();
-
-    // Mark character as online in DB
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_CHAR_ONLINE);
-    stmt->SetData(0, bot->GetGUID().GetCounter());
-    CharacterDatabase.Execute(stmt);
-
-    bot->SetInGameTime(GameTime::GetGameTimeMS().count());
-
-    // ── Party: create or join ──
-    Group* group = master->GetGroup();
-    if (!group)
-    {
-        group = new Group();
-        group->Create(master);
+        auto bots = sBotMgr.RemoveAllBots(masterLow);
+        for (auto& entry : bots)
+        {
+            DismissOneBot(entry, trans);
+            ++count;
+        }
     }
-    group->AddMember(bot);
-
-    // ── Detect role and spec ──
-    BotRole role = DetectBotRole(bot);
-    uint8 specIdx = DetectSpecIndex(bot);
-
-    // Register with BotManager
-    ObjectGuid::LowType masterLow = master->GetGUID().GetCounter();
-    sBotMgr.AddBot(masterLow, { bot, botSession, role, specIdx, false, false, 0, ObjectGuid::Empty });
-
-    // ── Start following master ──
-    bot->GetMotionMaster()->MoveFollow(master, 4.0f, float(M_PI));
-
-    // Role name for display
-    const char* roleName = "DPS";
-    if (role == BotRole::ROLE_TANK) roleName = "Tank";
-    else if (role == BotRole::ROLE_HEALER) roleName = "Healer";
-    else if (role == BotRole::ROLE_MELEE_DPS) roleName = "Melee DPS";
-    else if (role == BotRole::ROLE_RANGED_DPS) roleName = "Ranged DPS";
-
-    // Notify master
-    ChatHandler(master->GetSession()).PSendSysMessage("|cff00ff00{} has joined your party as {}!|r", bot->GetName(), roleName);
-    LOG_INFO("module", "RPGBots: Bot {} spawned as {} for {}", bot->GetName(), roleName, master->GetName());
+    sBotOnlineTracker.FlushInto(trans);
+    CharacterDatabase.DirectCommitTransaction(trans);
+    return count;
 }
 
 // ─── Command Script ────────────────────────────────────────────────────────────
@@ -391,6 +180,8 @@ public:
                 { "dismiss",  HandleArmyDismissCommand,      SEC_PLAYER,     Console::No },
                 { "dismissone", HandleArmyDismissOneCommand, SEC_PLAYER,     Console::No },
                 { "role",     HandleArmyRoleCommand,         SEC_PLAYER,     Console::No },
+                { "spec",     HandleArmySpecCommand,         SEC_PLAYER,     Console::No },
+                { "formation", HandleArmyFormationCommand,    SEC_PLAYER,     Console::No },
                 { "rotation", HandleArmyShowRotationCommand, SEC_PLAYER,     Console::No },
                 { "reload",   HandleArmyReloadCommand,       SEC_GAMEMASTER, Console::No },
                 { "selfbot",  HandleArmySelfBotCommand,      SEC_PLAYER,     Console::No },
@@ -402,6 +193,25 @@ public:
         return commandTable;
     }
 
+    // Call right after Enqueue: tell the master their queue position unless
+    // the spawn goes out on the next tick (admission open right now and
+    // nobody queued ahead).  Returns false when nothing was reported.
+    static bool ReportSpawnQueue(ChatHandler* handler, ObjectGuid::LowType masterLow)
+    {
+        uint32 pos = sBotSpawner.GetQueuePosition(masterLow);
+        if (!pos)
+            return false;
+
+        SpawnAdmission admission = sBotSpawner.CheckAdmission();
+        if (admission == SpawnAdmission::OPEN && pos == 1)
+            return false;
+
+        handler->PSendSysMessage("|cffffd700Spawn queued ({}). You are #{} of {} — see .army queue.|r",
+            admission == SpawnAdmission::OPEN ? "behind other spawns" : BotSpawnProcessor::AdmissionName(admission),
+            pos, sBotSpawner.GetQueuedCount());
+        return true;
+    }
+
     // .army list — show available alts on this account
     static bool HandleArmyListCommand(ChatHandler* handler)
     {
@@ -443,12 +253,14 @@ public:
         if (!master)
             return false;
 
-        // Enforce max bots limit from config
-        auto* currentBots = sBotMgr.GetBots(master->GetGUID().GetCounter());
-        uint32 botCount = currentBots ? static_cast<uint32>(currentBots->size()) : 0;
+        // Enforce max bots limit from config (spawns still in the queue count)
+        ObjectGuid::LowType masterLow = master->GetGUID().GetCounter();
+        auto* currentBots = sBotMgr.GetBots(masterLow);
+        uint32 botCount = (currentBots ? static_cast<uint32>(currentBots->size()) : 0)
+            + sBotSpawner.GetPendingCount(masterLow);
         if (botCount >= RPGBotsConfig::AltArmyMaxBots)
         {
-            handler->PSendSysMessage("|cffff0000You already have {} bot(s) active (max: {}). Dismiss one first.|r",
+            handler->PSendSysMessage("|cffff0000You already have {} bot(s) active or spawning (max: {}). Dismiss one first.|r",
                 botCount, RPGBotsConfig::AltArmyMaxBots);
             return true;
         }
@@ -456,29 +268,35 @@ public:
         uint32 accountId = master->GetSession()->GetAccountId();
         ObjectGuid::LowType masterGuidLow = master->GetGUID().GetCounter();
 
-        // Find the alt in the character database
-        QueryResult result;
+        // Find the alt: by name from the character cache (no query, and the
+        // typed name never reaches SQL), else the first alt on the account
+        uint32 altGuidLow = 0;
+        std::string altName;
         if (nameArg)
         {
-            result = CharacterDatabase.Query(
-                "SELECT guid, name FROM characters WHERE account = {} AND guid != {} AND name = '{}'",
-                accountId, masterGuidLow, *nameArg);
+            std::string name = *nameArg;
+            CharacterCacheEntry const* entry = normalizePlayerName(name)
+                ? sCharacterCache->GetCharacterCacheByName(name) : nullptr;
+            if (entry && entry->AccountId == accountId && entry->Guid.GetCounter() != masterGuidLow)
+            {
+                altGuidLow = entry->Guid.GetCounter();
+                altName    = entry->Name;
+            }
         }
-        else
+        else if (QueryResult result = CharacterDatabase.Query(
+                     "SELECT guid, name FROM characters WHERE account = {} AND guid != {} LIMIT 1",
+                     accountId, masterGuidLow))
         {
-            result = CharacterDatabase.Query(
-                "SELECT guid, name FROM characters WHERE account = {} AND guid != {} LIMIT 1",
-                accountId, masterGuidLow);
+            altGuidLow = (*result)[0].Get<uint32>();
+            altName    = (*result)[1].Get<std::string>();
         }
 
-        if (!result)
+        if (!altGuidLow)
         {
             handler->PSendSysMessage("|cffff0000No alt found. Use .army list to see available alts.|r");
             return true;
         }
 
-        uint32 altGuidLow = (*result)[0].Get<uint32>();
-        std::string altName = (*result)[1].Get<std::string>();
         ObjectGuid altGuid = ObjectGuid::Create<HighGuid::Player>(altGuidLow);
 
         // Check if alt is already online (either real player or existing bot)
@@ -488,46 +306,17 @@ public:
             return true;
         }
 
-        // Create a socketless WorldSession for the bot
-        // Uses the real account ID so LoadFromDB's account check passes
-        WorldSession* botSession = new WorldSession(
-            accountId,                          // account id (must match character's account)
-            std::string(altName),               // session name
-            0,                                  // account flags
-            nullptr,                            // no socket — this is a bot
-            SEC_PLAYER,                         // security
-            EXPANSION_WRATH_OF_THE_LICH_KING,   // expansion
-            0,                                  // mute time
-            LOCALE_enUS,                        // locale
-            0,                                  // recruiter
-            false,                              // isARecruiter
-            true,                               // skipQueue
-            0                                   // totalTime
-        );
-        // NOTE: We intentionally do NOT register this session with sWorldSessionMgr
-        // to avoid colliding with the master's real session (same account ID).
-
-        // Build the login query holder (same queries the normal login uses)
-        auto queryHolder = std::make_shared<BotLoginQueryHolder>(accountId, altGuid);
-        if (!queryHolder->Initialize())
+        if (sBotSpawner.IsPending(altGuid))
         {
-            handler->PSendSysMessage("|cffff0000Failed to initialize bot login queries.|r");
-            delete botSession;
+            handler->PSendSysMessage("|cffff0000{} is already on the way!|r", altName);
             return true;
         }
 
-        // Execute the queries asynchronously through the MASTER's session update loop.
-        // When the queries finish, FinishBotSpawn() is called to complete the spawn.
-        ObjectGuid masterGuid = master->GetGUID();
-        master->GetSession()->AddQueryHolderCallback(
-            CharacterDatabase.DelayQueryHolder(queryHolder)
-        ).AfterComplete([masterGuid, botSession, altGuid](SQLQueryHolderBase const& holder)
-        {
-            FinishBotSpawn(masterGuid, botSession, altGuid,
-                           static_cast<CharacterDatabaseQueryHolder const&>(holder));
-        });
+        // Login queries, session lease and map add run in the spawn processor
+        sBotSpawner.Enqueue(master, altGuid, altName);
 
-        handler->PSendSysMessage("|cff00ff00Spawning {}... They will join your party shortly.|r", altName);
+        if (!ReportSpawnQueue(handler, masterLow))
+            handler->PSendSysMessage("|cff00ff00Spawning {}... They will join your party shortly.|r", altName);
         LOG_INFO("module", "RPGBots: {} spawning alt {} (GUID: {})",
             master->GetName(), altName, altGuidLow);
 
@@ -541,9 +330,10 @@ public:
         if (!master)
             return false;
 
-        // Count current bots for this master
+        // Count current bots for this master (including queued spawns)
         auto* existingBots = sBotMgr.GetBots(master->GetGUID().GetCounter());
-        uint32 currentBots = existingBots ? static_cast<uint32>(existingBots->size()) : 0;
+        uint32 currentBots = (existingBots ? static_cast<uint32>(existingBots->size()) : 0)
+            + sBotSpawner.GetPendingCount(master->GetGUID().GetCounter());
 
         uint32 accountId = master->GetSession()->GetAccountId();
         ObjectGuid::LowType masterGuidLow = master->GetGUID().GetCounter();
@@ -558,6 +348,11 @@ public:
             return true;
         }
 
+        // Pre-build the sessions this batch will lease
+        uint32 freeSlots = RPGBotsConfig::AltArmyMaxBots > currentBots
+            ? RPGBotsConfig::AltArmyMaxBots - currentBots : 0;
+        sBotSessionPool.Prewarm(accountId, std::min<uint32>(freeSlots, uint32(result->GetRowCount())));
+
         uint32 spawned = 0;
         do {
             // Enforce max bots limit
@@ -573,81 +368,183 @@ public:
             std::string altName = fields[1].Get<std::string>();
             ObjectGuid altGuid = ObjectGuid::Create<HighGuid::Player>(altGuidLow);
 
-            // Skip if already in the world
-            if (ObjectAccessor::FindPlayer(altGuid))
+            // Skip if already in the world or on the way
+            if (ObjectAccessor::FindPlayer(altGuid) || sBotSpawner.IsPending(altGuid))
                 continue;
 
-            WorldSession* botSession = new WorldSession(
-                accountId, std::string(altName), 0, nullptr,
-                SEC_PLAYER, EXPANSION_WRATH_OF_THE_LICH_KING,
-                0, LOCALE_enUS, 0, false, true, 0);
+            sBotSpawner.Enqueue(master, altGuid, altName);
+            ++spawned;
+        } while (result->NextRow());
 
-            auto queryHolder = std::make_shared<BotLoginQueryHolder>(accountId, altGuid);
-            if (!queryHolder->Initialize())
+        if (spawned == 0)
+            handler->PSendSysMessage("|cffff0000All alts are already in the world.|r");
+        else if (!ReportSpawnQueue(handler, masterGuidLow))
+            handler->PSendSysMessage("|cff00ff00Spawning {} alt(s)... They will join your party shortly.|r", spawned);
+
+        return true;
+    }
+
+    // .army role <name> <tank|heal|dps|rdps|auto> — manually override a bot's role
+    // .army role auto — drop every override in the army, back to talent detection
+    static bool HandleArmyRoleCommand(ChatHandler* handler, std::string nameArg, Optional<std::string> roleArg)
+    {
+        Player* master = handler->GetSession()->GetPlayer();
+        if (!master)
+            return false;
+
+        ObjectGuid::LowType masterLow = master->GetGUID().GetCounter();
+
+        if (!roleArg)
+        {
+            if (nameArg != "auto")
             {
-                delete botSession;
-                continue;
+                handler->PSendSysMessage("|cffff0000Usage: .army role <name> <tank|heal|dps|rdps|auto> or .army role auto|r");
+                return true;
             }
 
-            ObjectGuid masterGuid = master->GetGUID();
-            master->GetSession()->AddQueryHolderCallback(
-                CharacterDatabase.DelayQueryHolder(queryHolder)
-            ).AfterComplete([masterGuid, botSession, altGuid](SQLQueryHolderBase const& holder)
+            std::vector<BotInfo>* bots = sBotMgr.GetBots(masterLow);
+            if (!bots || bots->empty())
             {
-                FinishBotSpawn(masterGuid, botSession, altGuid,
-                               static_cast<CharacterDatabaseQueryHolder const&>(holder));
-            });
-            ++spawned;
-        } while (result->NextRow());
+                handler->PSendSysMessage("|cffff0000You have no bots.|r");
+                return true;
+            }
 
-        if (spawned > 0)
-            handler->PSendSysMessage("|cff00ff00Spawning {} alt(s)... They will join your party shortly.|r", spawned);
+            // One roster transaction for the whole army
+            RPGBotsDatabaseTransaction trans = RPGBotsDatabase.BeginTransaction();
+            uint32 updated = 0;
+            uint32 changed = 0;
+            uint32 perRole[4] = {};
+            for (BotInfo& info : *bots)
+            {
+                if (!info.player)
+                    continue;
+                BotRole previous = info.role;
+                info.roleOverride = BOT_NO_OVERRIDE;
+                info.specOverride = BOT_NO_OVERRIDE;
+                RefreshRoleAndSpec(info);
+                sArmyRoster.SaveBotInto(trans, masterLow, info);
+                ++updated;
+                if (info.role != previous)
+                    ++changed;
+                ++perRole[uint8(info.role)];
+            }
+            RPGBotsDatabase.CommitTransaction(trans);
+
+            handler->PSendSysMessage("|cff00ff00Roles re-detected for {} bots ({} changed): "
+                "{} tank, {} healer, {} melee, {} ranged.|r", updated, changed,
+                perRole[uint8(BotRole::ROLE_TANK)], perRole[uint8(BotRole::ROLE_HEALER)],
+                perRole[uint8(BotRole::ROLE_MELEE_DPS)], perRole[uint8(BotRole::ROLE_RANGED_DPS)]);
+            return true;
+        }
+
+        BotInfo* info = sBotMgr.FindBot(masterLow, nameArg);
+        if (!info)
+        {
+            handler->PSendSysMessage("|cffff0000No bot named '{}' found in your army.|r", nameArg);
+            return true;
+        }
+
+        std::string const& role = *roleArg;
+        uint8 roleOverride;
+        if (role == "tank")
+            roleOverride = uint8(BotRole::ROLE_TANK);
+        else if (role == "heal" || role == "healer")
+            roleOverride = uint8(BotRole::ROLE_HEALER);
+        else if (role == "dps" || role == "melee")
+            roleOverride = uint8(BotRole::ROLE_MELEE_DPS);
+        else if (role == "rdps" || role == "ranged")
+            roleOverride = uint8(BotRole::ROLE_RANGED_DPS);
+        else if (role == "auto" && info->player)
+            roleOverride = BOT_NO_OVERRIDE;
         else
-            handler->PSendSysMessage("|cffff0000All alts are already in the world.|r");
+        {
+            handler->PSendSysMessage("|cffff0000Unknown role '{}'. Use: tank, heal, dps, rdps, auto|r", role);
+            return true;
+        }
 
+        // The override survives relogs and talent changes until set back to auto
+        info->roleOverride = roleOverride;
+        RefreshRoleAndSpec(*info);
+        sArmyRoster.SaveBot(masterLow, *info);
+
+        handler->PSendSysMessage("|cff00ff00{} is now set to {}{}.|r", nameArg, BotRoleName(info->role),
+            roleOverride == BOT_NO_OVERRIDE ? " (detected)" : "");
         return true;
     }
 
-    // .army role <name> <tank|heal|dps|rdps> — manually override a bot's role
-    static bool HandleArmyRoleCommand(ChatHandler* handler, std::string nameArg, std::string roleArg)
+    // .army spec <name> <0|1|2|auto> — pin the spec a bot's rotation is read from
+    static bool HandleArmySpecCommand(ChatHandler* handler, std::string nameArg, std::string specArg)
     {
         Player* master = handler->GetSession()->GetPlayer();
         if (!master)
             return false;
 
         ObjectGuid::LowType masterLow = master->GetGUID().GetCounter();
-
         BotInfo* info = sBotMgr.FindBot(masterLow, nameArg);
-        if (!info)
+        if (!info || !info->player)
         {
             handler->PSendSysMessage("|cffff0000No bot named '{}' found in your army.|r", nameArg);
             return true;
         }
 
-        BotRole newRole;
-        if (roleArg == "tank")
-            newRole = BotRole::ROLE_TANK;
-        else if (roleArg == "heal" || roleArg == "healer")
-            newRole = BotRole::ROLE_HEALER;
-        else if (roleArg == "dps" || roleArg == "melee")
-            newRole = BotRole::ROLE_MELEE_DPS;
-        else if (roleArg == "rdps" || roleArg == "ranged")
-            newRole = BotRole::ROLE_RANGED_DPS;
+        uint8 specOverride;
+        if (specArg == "auto")
+            specOverride = BOT_NO_OVERRIDE;
+        else if (specArg.size() == 1 && specArg[0] >= '0' && specArg[0] <= '2')
+            specOverride = uint8(specArg[0] - '0');
         else
         {
-            handler->PSendSysMessage("|cffff0000Unknown role '{}'. Use: tank, heal, dps, rdps|r", roleArg);
+            handler->PSendSysMessage("|cffff0000Usage: .army spec <name> <0|1|2|auto>|r");
+            return true;
+        }
+
+        info->specOverride = specOverride;
+        RefreshRoleAndSpec(*info);
+        sArmyRoster.SaveBot(masterLow, *info);
+
+        SpecRotation const* rotation = sRotationEngine.GetRotation(info->player->getClass(), info->specIndex);
+        handler->PSendSysMessage("|cff00ff00{} now uses spec {} ({}){}.|r", nameArg, info->specIndex,
+            rotation ? rotation->specName : std::string("no rotation loaded"),
+            specOverride == BOT_NO_OVERRIDE ? ", detected from talents" : "");
+        return true;
+    }
+
+    // .army formation [arrow|line|follow] — show or set the out-of-combat formation
+    static bool HandleArmyFormationCommand(ChatHandler* handler, Optional<std::string> formationArg)
+    {
+        Player* master = handler->GetSession()->GetPlayer();
+        if (!master)
+            return false;
+
+        ObjectGuid::LowType masterLow = master->GetGUID().GetCounter();
+        if (!formationArg)
+        {
+            handler->PSendSysMessage("|cff00ff00[Army] Formation: {}.|r Usage: .army formation <arrow|line|follow>",
+                BotFormationName(sBotMgr.GetFormation(masterLow)));
+            return true;
+        }
+
+        std::string const& name = *formationArg;
+        BotFormation formation = BotFormation::MAX_FORMATIONS;
+        for (uint8 i = 0; i < uint8(BotFormation::MAX_FORMATIONS); ++i)
+            if (name == BotFormationName(BotFormation(i)))
+                formation = BotFormation(i);
+
+        if (formation == BotFormation::MAX_FORMATIONS)
+        {
+            handler->PSendSysMessage("|cffff0000Unknown formation '{}'. Use: arrow, line, follow|r", name);
             return true;
         }
 
-        info->role = newRole;
+        sBotMgr.SetFormation(masterLow, formation);
+        sArmyRoster.SaveFormation(masterLow, formation);
 
-        const char* roleName = "DPS";
-        if (newRole == BotRole::ROLE_TANK) roleName = "Tank";
-        else if (newRole == BotRole::ROLE_HEALER) roleName = "Healer";
-        else if (newRole == BotRole::ROLE_MELEE_DPS) roleName = "Melee DPS";
-        else if (newRole == BotRole::ROLE_RANGED_DPS) roleName = "Ranged DPS";
+        // Out of formation, bots fall back to plain following
+        if (std::vector<BotInfo>* bots = sBotMgr.GetBots(masterLow))
+            for (BotInfo& info : *bots)
+                info.isFollowing = false;
 
-        handler->PSendSysMessage("|cff00ff00{} is now set to {}.|r", nameArg, roleName);
+        handler->PSendSysMessage("|cff00ff00[Army] Formation set to {}.|r", BotFormationName(formation));
         return true;
     }
 
@@ -757,6 +654,7 @@ public:
 
         uint32 count = sBotMgr.GetBots(masterLow)->size();
         DismissAllBots(masterLow);
+        sArmyRoster.RemoveArmy(masterLow);
         handler->PSendSysMessage("|cff00ff00Dismissed {} bot alt(s). Army removed.|r", count);
         return true;
     }
@@ -776,7 +674,13 @@ public:
             return true;
         }
 
-        DismissOneBot(*removed);
+        if (removed->player)
+            sArmyRoster.RemoveBot(masterLow, removed->player->GetGUID().GetCounter());
+
+        CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+        DismissOneBot(*removed, trans);
+        sBotOnlineTracker.FlushInto(trans);
+        CharacterDatabase.CommitTransaction(trans);
         handler->PSendSysMessage("|cff00ff00Dismissed bot '%s'.|r", name.c_str());
         return true;
     }
@@ -794,11 +698,34 @@ public:
             return;
 
         ObjectGuid::LowType masterLow = player->GetGUID().GetCounter();
+
+        // Spawns still queued or loading for this master must not land
+        if (uint32 cancelled = sBotSpawner.CancelForMaster(masterLow))
+            LOG_INFO("module", "RPGBots: Master {} logging out, cancelled {} pending spawn(s)", player->GetName(), cancelled);
+
         if (sBotMgr.HasBots(masterLow))
         {
             LOG_INFO("module", "RPGBots: Master {} logging out, dismissing all bots", player->GetName());
             DismissAllBots(masterLow);
         }
+        sBotMgr.ForgetFormation(masterLow);
+    }
+};
+
+// ─── World Script: bulk-dismiss every army on shutdown ─────────────────────────
+class ArmyShutdownCleanup : public WorldScript
+{
+public:
+    ArmyShutdownCleanup() : WorldScript("ArmyShutdownCleanup") {}
+
+    void OnShutdown() override
+    {
+        uint32 count = DismissAllArmies();
+        if (count)
+            LOG_INFO("module", "RPGBots: Shutdown dismissed {} bot(s) in one batch", count);
+        // Dismissed sessions are still draining; free those too
+        if (uint32 freed = sBotSessionPool.Shutdown())
+            LOG_INFO("module", "RPGBots: Shutdown freed {} bot session(s)", freed);
     }
 };
 
@@ -806,4 +733,5 @@ void AddArmyOfAlts()
 {
     new ArmyOfAlts();
     new ArmyBotCleanup();
+    new ArmyShutdownCleanup();
 }
@@ -0,0 +1,217 @@
+// ArmyRoster.cpp
+// army_roster persistence and staggered restore on login.  See ArmyRoster.h.
+
+#include "ArmyRoster.h"
+#include "BotAI.h"
+#include "BotSpawnProcessor.h"
+#include "CharacterCache.h"
+#include "Chat.h"
+#include "Log.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+#include "RPGBotsConfig.h"
+#include "RPGBotsDatabase.h"
+#include "ScriptMgr.h"
+#include "Timer.h"
+#include "WorldSession.h"
+#include <algorithm>
+
+// ─── Roster writes ─────────────────────────────────────────────────────────────
+RPGBotsDatabasePreparedStatement* ArmyRoster::BuildSaveBot(ObjectGuid::LowType masterLow, BotInfo const& info)
+{
+    RPGBotsDatabasePreparedStatement* stmt = RPGBotsDatabase.GetPreparedStatement(RPGBOTS_REP_ARMY_ROSTER);
+    stmt->SetData(0, masterLow);
+    stmt->SetData(1, info.player->GetGUID().GetCounter());
+    stmt->SetData(2, info.roleOverride);
+    stmt->SetData(3, info.specOverride);
+    stmt->SetData(4, uint8(sBotMgr.GetFormation(masterLow)));
+    return stmt;
+}
+
+void ArmyRoster::SaveBot(ObjectGuid::LowType masterLow, BotInfo const& info)
+{
+    if (info.player)
+        RPGBotsDatabase.Execute(BuildSaveBot(masterLow, info));
+}
+
+void ArmyRoster::SaveBotInto(RPGBotsDatabaseTransaction& trans, ObjectGuid::LowType masterLow, BotInfo const& info)
+{
+    if (info.player)
+        trans->Append(BuildSaveBot(masterLow, info));
+}
+
+void ArmyRoster::RemoveBot(ObjectGuid::LowType masterLow, ObjectGuid::LowType botLow)
+{
+    RPGBotsDatabasePreparedStatement* stmt = RPGBotsDatabase.GetPreparedStatement(RPGBOTS_DEL_ARMY_ROSTER_BOT);
+    stmt->SetData(0, masterLow);
+    stmt->SetData(1, botLow);
+    RPGBotsDatabase.Execute(stmt);
+}
+
+void ArmyRoster::RemoveArmy(ObjectGuid::LowType masterLow)
+{
+    RPGBotsDatabasePreparedStatement* stmt = RPGBotsDatabase.GetPreparedStatement(RPGBOTS_DEL_ARMY_ROSTER);
+    stmt->SetData(0, masterLow);
+    RPGBotsDatabase.Execute(stmt);
+}
+
+void ArmyRoster::SaveFormation(ObjectGuid::LowType masterLow, BotFormation formation)
+{
+    RPGBotsDatabasePreparedStatement* stmt = RPGBotsDatabase.GetPreparedStatement(RPGBOTS_UPD_ARMY_ROSTER_FORMATION);
+    stmt->SetData(0, uint8(formation));
+    stmt->SetData(1, masterLow);
+    RPGBotsDatabase.Execute(stmt);
+}
+
+void ArmyRoster::OnBotSpawned(ObjectGuid::LowType masterLow, BotInfo& info)
+{
+    auto it = _held.find(info.player->GetGUID().GetCounter());
+    if (it != _held.end())
+    {
+        info.roleOverride = it->second.role;
+        info.specOverride = it->second.spec;
+        _held.erase(it);
+        RefreshRoleAndSpec(info);
+    }
+    SaveBot(masterLow, info);
+}
+
+// ─── Restore ───────────────────────────────────────────────────────────────────
+void ArmyRoster::QueueRestore(Player* master)
+{
+    if (!RPGBotsConfig::RosterRestore)
+        return;
+    _restoreQueue.push_back({ master->GetGUID(), getMSTime() });
+}
+
+void ArmyRoster::CancelRestore(ObjectGuid::LowType masterLow)
+{
+    _restoreQueue.erase(std::remove_if(_restoreQueue.begin(), _restoreQueue.end(),
+        [masterLow](PendingRestore const& p) { return p.masterGuid.GetCounter() == masterLow; }),
+        _restoreQueue.end());
+}
+
+void ArmyRoster::Update(uint32 diff)
+{
+    _sinceLastMs += diff;
+    if (_restoreQueue.empty() || _sinceLastMs < RPGBotsConfig::RosterRestoreIntervalMs)
+        return;
+
+    // FIFO: the head is always the earliest login
+    PendingRestore head = _restoreQueue.front();
+    if (getMSTimeDiff(head.queuedMs, getMSTime()) < RPGBotsConfig::RosterRestoreDelayMs)
+        return;
+
+    _restoreQueue.pop_front();
+    _sinceLastMs = 0;
+    Restore(head.masterGuid);
+}
+
+void ArmyRoster::Restore(ObjectGuid masterGuid)
+{
+    RPGBotsDatabasePreparedStatement* stmt = RPGBotsDatabase.GetPreparedStatement(RPGBOTS_SEL_ARMY_ROSTER);
+    stmt->SetData(0, masterGuid.GetCounter());
+    RPGBotsDatabase.AddCallback(RPGBotsDatabase.AsyncQuery(stmt)).WithPreparedCallback([this, masterGuid](PreparedQueryResult result)
+    {
+        HandleRosterLoaded(masterGuid, std::move(result));
+    });
+}
+
+void ArmyRoster::HandleRosterLoaded(ObjectGuid masterGuid, PreparedQueryResult result)
+{
+    if (!result)
+        return;
+
+    // The master may have logged out while the query was in flight
+    Player* master = ObjectAccessor::FindConnectedPlayer(masterGuid);
+    if (!master || !master->IsInWorld())
+        return;
+
+    ObjectGuid::LowType masterLow = masterGuid.GetCounter();
+    uint32 accountId = master->GetSession()->GetAccountId();
+
+    auto* currentBots = sBotMgr.GetBots(masterLow);
+    uint32 active = (currentBots ? uint32(currentBots->size()) : 0) + sBotSpawner.GetPendingCount(masterLow);
+    uint32 room   = active < RPGBotsConfig::AltArmyMaxBots ? RPGBotsConfig::AltArmyMaxBots - active : 0;
+
+    uint32 queued = 0;
+    do {
+        Field* f = result->Fetch();
+        ObjectGuid::LowType botLow = f[0].Get<uint32>();
+        uint8 role      = f[1].Get<uint8>();
+        uint8 spec      = f[2].Get<uint8>();
+        uint8 formation = f[3].Get<uint8>();
+
+        if (formation < uint8(BotFormation::MAX_FORMATIONS))
+            sBotMgr.SetFormation(masterLow, BotFormation(formation));
+
+        // Deleted or moved to another account since: drop the row
+        ObjectGuid botGuid = ObjectGuid::Create<HighGuid::Player>(botLow);
+        CharacterCacheEntry const* entry = sCharacterCache->GetCharacterCacheByGuid(botGuid);
+        if (!entry || entry->AccountId != accountId)
+        {
+            RemoveBot(masterLow, botLow);
+            continue;
+        }
+
+        if (ObjectAccessor::FindConnectedPlayer(botGuid) || sBotSpawner.IsPending(botGuid))
+            continue;
+        if (queued >= room)
+            break;
+        if (!sBotSpawner.Enqueue(master, botGuid, entry->Name))
+            continue;
+
+        HeldOverrides held;
+        held.role = role < 4 ? role : BOT_NO_OVERRIDE;
+        held.spec = spec < 3 ? spec : BOT_NO_OVERRIDE;
+        if (held.role != BOT_NO_OVERRIDE || held.spec != BOT_NO_OVERRIDE)
+            _held[botLow] = held;
+        ++queued;
+    } while (result->NextRow());
+
+    if (!queued)
+        return;
+
+    ++_restoredArmies;
+    _restoredBots += queued;
+    ChatHandler(master->GetSession()).PSendSysMessage("|cff00ff00Restoring your army: {} bot(s) queued.|r", queued);
+    LOG_INFO("module", "RPGBots: Restoring {} roster bot(s) for {}", queued, master->GetName());
+}
+
+// ─── Scripts: queue on login, drain on the world tick ──────────────────────────
+class ArmyRosterPlayerScript : public PlayerScript
+{
+public:
+    ArmyRosterPlayerScript() : PlayerScript("ArmyRosterPlayerScript",
+        {PLAYERHOOK_ON_LOGIN, PLAYERHOOK_ON_LOGOUT}) {}
+
+    void OnPlayerLogin(Player* player) override
+    {
+        // Bots never fire OnPlayerLogin, so this is always a real master
+        if (player)
+            sArmyRoster.QueueRestore(player);
+    }
+
+    void OnPlayerLogout(Player* player) override
+    {
+        if (player)
+            sArmyRoster.CancelRestore(player->GetGUID().GetCounter());
+    }
+};
+
+class ArmyRosterWorldScript : public WorldScript
+{
+public:
+    ArmyRosterWorldScript() : WorldScript("ArmyRosterWorldScript") {}
+
+    void OnUpdate(uint32 diff) override
+    {
+        sArmyRoster.Update(diff);
+    }
+};
+
+void AddArmyRoster()
+{
+    new ArmyRosterPlayerScript();
+    new ArmyRosterWorldScript();
+}
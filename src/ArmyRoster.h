@@ -0,0 +1,91 @@
+// ArmyRoster.h
+// Persisted armies: rpgbots.army_roster keeps each master's bots, their
+// role/spec overrides and the formation, so an army survives relogs and
+// restarts.
+//
+// Writes are small async statements on the rpgbots pool, issued when a bot
+// spawns, an override or the formation changes, or bots are dismissed by
+// command.  Logout and shutdown dismissals keep the rows.
+//
+// On master login the army is queued for restore.  Restores are staggered:
+// at most one army is read per RPGBots.Roster.RestoreInterval, starting
+// RPGBots.Roster.RestoreDelay after login, and its bots go through the
+// normal spawn queue (with its own rate limit).  After a realm restart the
+// armies come back one by one instead of in the same tick.  Overrides read
+// from the roster are held until the bot's spawn completes, and dropped if
+// it fails or is cancelled.
+
+#pragma once
+
+#include "BotBehavior.h"
+#include "ObjectGuid.h"
+#include "QueryResult.h"
+#include "RPGBotsDatabase.h"
+#include <deque>
+#include <unordered_map>
+
+class Player;
+struct BotInfo;
+
+class ArmyRoster
+{
+public:
+    static ArmyRoster& Instance()
+    {
+        static ArmyRoster instance;
+        return instance;
+    }
+
+    // ── Roster writes ──
+    void SaveBot(ObjectGuid::LowType masterLow, BotInfo const& info);
+    // Same row, appended to an army-wide transaction
+    void SaveBotInto(RPGBotsDatabaseTransaction& trans, ObjectGuid::LowType masterLow, BotInfo const& info);
+    void RemoveBot(ObjectGuid::LowType masterLow, ObjectGuid::LowType botLow);
+    void RemoveArmy(ObjectGuid::LowType masterLow);
+    void SaveFormation(ObjectGuid::LowType masterLow, BotFormation formation);
+
+    // Spawn completion: apply overrides held from a restore, then record the bot
+    void OnBotSpawned(ObjectGuid::LowType masterLow, BotInfo& info);
+
+    // Spawn failed or cancelled: forget overrides held for it
+    void DropHeld(ObjectGuid::LowType botLow) { _held.erase(botLow); }
+
+    // ── Restore ──
+    void QueueRestore(Player* master);
+    void CancelRestore(ObjectGuid::LowType masterLow);
+    void Update(uint32 diff);
+
+    uint32 GetQueuedCount()    const { return uint32(_restoreQueue.size()); }
+    uint64 GetRestoredArmies() const { return _restoredArmies; }
+    uint64 GetRestoredBots()   const { return _restoredBots; }
+
+private:
+    ArmyRoster() = default;
+
+    void Restore(ObjectGuid masterGuid);
+    void HandleRosterLoaded(ObjectGuid masterGuid, PreparedQueryResult result);
+    static RPGBotsDatabasePreparedStatement* BuildSaveBot(ObjectGuid::LowType masterLow, BotInfo const& info);
+
+    struct PendingRestore
+    {
+        ObjectGuid masterGuid;
+        uint32     queuedMs;   // getMSTime() at login
+    };
+
+    struct HeldOverrides
+    {
+        uint8 role;
+        uint8 spec;
+    };
+
+    std::deque<PendingRestore>                                  _restoreQueue;
+    std::unordered_map<ObjectGuid::LowType, HeldOverrides>      _held;   // bot → overrides
+    uint32 _sinceLastMs    = 0;
+    uint64 _restoredArmies = 0;
+    uint64 _restoredBots   = 0;
+};
+
+#define sArmyRoster ArmyRoster::Instance()
+
+// Registration
+void AddArmyRoster();
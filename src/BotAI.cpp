@@ -15,7 +15,15 @@
 
 #include "BotAI.h"
 #include "BotBehavior.h"
+#include "BotDecisionTrace.h"
+#include "BotHibernation.h"
+#include "BotLod.h"
+#include "BotProfiler.h"
+#include "BotTickBudget.h"
 #include "RotationEngine.h"
+#include "RollEngine.h"
+#include "ProfileStore.h"
+#include "RPGBotsConfig.h"
 #include "ScriptMgr.h"
 #include "Player.h"
 #include "ObjectAccessor.h"
@@ -29,6 +37,7 @@
 #include "SpellMgr.h"
 #include "Item.h"
 #include "ItemTemplate.h"
+#include "Timer.h"
 #include <cmath>
 #include <algorithm>
 
@@ -88,6 +97,12 @@ uint8 DetectSpecIndex(Player* bot)
     return sRotationEngine.DetectBestSpecIndex(bot, fallback);
 }
 
+void RefreshRoleAndSpec(BotInfo& info)
+{
+    info.specIndex = info.specOverride != BOT_NO_OVERRIDE ? info.specOverride : DetectSpecIndex(info.player);
+    info.role      = info.roleOverride != BOT_NO_OVERRIDE ? BotRole(info.roleOverride) : DetectBotRole(info.player);
+}
+
 // ─── Helpers ───────────────────────────────────────────────────────────────────
 
 static float Dist2D(Unit* a, Unit* b)
@@ -130,35 +145,74 @@ static Player* FindLowestHP(Player* bot, Player* master)
     return lowest;
 }
 
+// ─── Decision trace ────────────────────────────────────────────────────────────
+// UpdateBotAI points this at the bot being updated; each runner sets its bucket.
+static BotTraceRing* s_traceRing   = nullptr;
+static uint8         s_traceBucket = TRACE_TARGET;
+
+static void Trace(uint32 spellId, ObjectGuid target, BotTraceOutcome outcome,
+                  SpellCastResult result = SPELL_CAST_OK)
+{
+    if (s_traceRing)
+        s_traceRing->Push({ sBotTickBudget.GetTickId(), getMSTime(), spellId, target,
+                            s_traceBucket, uint8(outcome), uint8(result) });
+}
+
+static void Trace(uint32 spellId, Unit* target, BotTraceOutcome outcome)
+{
+    Trace(spellId, target ? target->GetGUID() : ObjectGuid::Empty, outcome);
+}
+
+// Binds the trace to one bot for the rest of the scope
+class TraceScope
+{
+public:
+    explicit TraceScope(BotTraceRing* ring) { s_traceRing = ring; s_traceBucket = TRACE_TARGET; }
+    ~TraceScope() { s_traceRing = nullptr; }
+};
+
 // ─── Spell eligibility check (no cast — dry run) ──────────────────────────────
-// Returns true if the spell COULD be cast right now (has spell, not on CD, etc.)
+// TRACE_CAST if the spell COULD be cast right now, otherwise why not.
 
-static bool CanCast(Player* bot, Unit* target, uint32 spellId)
+static BotTraceOutcome CheckCast(Player* bot, Unit* target, uint32 spellId)
 {
-    if (spellId == 0)          return false;
-    if (!target)               return false;
-    if (!bot->HasSpell(spellId))       return false;
-    if (bot->HasSpellCooldown(spellId)) return false;
+    if (!target)                        return TRACE_NO_TARGET;
+    if (!bot->HasSpell(spellId))        return TRACE_NOT_KNOWN;
+    if (bot->HasSpellCooldown(spellId)) return TRACE_COOLDOWN;
 
     // Warlock Soulburn (Shadowburn): require soul shard (spec can be custom)
     if (spellId == WARLOCK_SOULBURN)
     {
         if (bot->GetItemCount(SOUL_SHARD_ITEM) == 0)
-            return false;
+            return TRACE_NO_REAGENT;
     }
 
-    return true;
+    return TRACE_CAST;
+}
+
+static bool CanCast(Player* bot, Unit* target, uint32 spellId)
+{
+    return spellId != 0 && CheckCast(bot, target, spellId) == TRACE_CAST;
 }
 
 // ─── Try to cast one spell ─────────────────────────────────────────────────────
-// Returns true if the spell was successfully cast.
+// Returns true if the spell was successfully cast.  Traced either way.
 
 static bool TryCast(Player* bot, Unit* target, uint32 spellId)
 {
-    if (!CanCast(bot, target, spellId))
+    if (spellId == 0)
+        return false;
+
+    BotTraceOutcome check = CheckCast(bot, target, spellId);
+    if (check != TRACE_CAST)
+    {
+        Trace(spellId, target, check);
         return false;
+    }
 
-    return bot->CastSpell(target, spellId, false) == SPELL_CAST_OK;
+    SpellCastResult result = bot->CastSpell(target, spellId, false);
+    Trace(spellId, target->GetGUID(), result == SPELL_CAST_OK ? TRACE_CAST : TRACE_CAST_FAILED, result);
+    return result == SPELL_CAST_OK;
 }
 
 // ─── Bucket Runners ────────────────────────────────────────────────────────────
@@ -171,16 +225,25 @@ static constexpr float  META_MANA_THRESHOLD   = 80.0f;
 // Buffs: cast on SELF if the aura is missing — ONLY during combat
 static bool RunBuffs(Player* bot, const std::array<uint32, SPELLS_PER_BUCKET>& spells)
 {
+    RPGBOTS_PERF_SCOPE(PERF_RUN_BUFFS);
+    s_traceBucket = TRACE_BUFFS;
     for (uint32 id : spells)
     {
         if (id == 0) continue;
-        if (bot->HasAura(id))  continue;                 // already have it
+        if (bot->HasAura(id))                            // already have it
+        {
+            Trace(id, bot, TRACE_AURA_PRESENT);
+            continue;
+        }
 
         // Warlock Metamorphosis: only pop Meta when mana > 80%
         if (id == WARLOCK_METAMORPHOSIS)
         {
             if (bot->GetPower(POWER_MANA) * 100 / std::max(bot->GetMaxPower(POWER_MANA), 1u) < META_MANA_THRESHOLD)
+            {
+                Trace(id, bot, TRACE_LOW_MANA);
                 continue;
+            }
         }
 
         if (TryCast(bot, bot, id)) return true;
@@ -189,9 +252,12 @@ static bool RunBuffs(Player* bot, const std::array<uint32, SPELLS_PER_BUCKET>& s
 }
 
 // Defensives: cast on SELF only when HP < threshold
-static bool RunDefensives(Player* bot, const std::array<uint32, SPELLS_PER_BUCKET>& spells)
+static bool RunDefensives(Player* bot, const std::array<uint32, SPELLS_PER_BUCKET>& spells,
+                          TraitModifiers const& mods)
 {
-    if (bot->GetHealthPct() >= DEFENSIVE_HP_PCT)
+    RPGBOTS_PERF_SCOPE(PERF_RUN_DEFENSIVES);
+    s_traceBucket = TRACE_DEFENSIVES;
+    if (bot->GetHealthPct() >= DEFENSIVE_HP_PCT + mods.defensiveHpOffset)
         return false; // not in danger, skip entire bucket
 
     for (uint32 id : spells)
@@ -207,12 +273,15 @@ static bool RunDefensives(Player* bot, const std::array<uint32, SPELLS_PER_BUCKE
 //   others  → enemy (master's target)
 static bool RunAbilities(Player* bot, Player* master, Unit* enemy,
                          BotRole role,
-                         const std::array<uint32, SPELLS_PER_BUCKET>& spells)
+                         const std::array<uint32, SPELLS_PER_BUCKET>& spells,
+                         TraitModifiers const& mods)
 {
+    RPGBOTS_PERF_SCOPE(PERF_RUN_ABILITIES);
+    s_traceBucket = TRACE_ABILITIES;
     if (role == BotRole::ROLE_HEALER)
     {
         Player* healTarget = FindLowestHP(bot, master);
-        if (!healTarget || healTarget->GetHealthPct() >= HEAL_THRESHOLD_PCT)
+        if (!healTarget || healTarget->GetHealthPct() >= HEAL_THRESHOLD_PCT + mods.healThresholdOffset)
             return false; // nobody needs healing
 
         for (uint32 id : spells)
@@ -237,11 +306,17 @@ static bool RunAbilities(Player* bot, Player* master, Unit* enemy,
 static bool RunDots(Player* bot, Unit* enemy,
                     const std::array<uint32, SPELLS_PER_BUCKET>& spells)
 {
+    RPGBOTS_PERF_SCOPE(PERF_RUN_DOTS);
+    s_traceBucket = TRACE_DOTS;
     if (!enemy) return false;
     for (uint32 id : spells)
     {
         if (id == 0) continue;
-        if (enemy->HasAura(id))  continue;               // already ticking
+        if (enemy->HasAura(id))                          // already ticking
+        {
+            Trace(id, enemy, TRACE_AURA_PRESENT);
+            continue;
+        }
         if (TryCast(bot, enemy, id)) return true;
     }
     return false;
@@ -251,12 +326,18 @@ static bool RunDots(Player* bot, Unit* enemy,
 static bool RunHots(Player* bot, Player* master,
                     const std::array<uint32, SPELLS_PER_BUCKET>& spells)
 {
+    RPGBOTS_PERF_SCOPE(PERF_RUN_HOTS);
+    s_traceBucket = TRACE_HOTS;
     Player* target = FindLowestHP(bot, master);
     if (!target) return false;
     for (uint32 id : spells)
     {
         if (id == 0) continue;
-        if (target->HasAura(id))  continue;              // already ticking
+        if (target->HasAura(id))                         // already ticking
+        {
+            Trace(id, target, TRACE_AURA_PRESENT);
+            continue;
+        }
         if (TryCast(bot, target, id)) return true;
     }
     return false;
@@ -266,6 +347,8 @@ static bool RunHots(Player* bot, Player* master,
 static bool RunMobility(Player* bot, Unit* enemy, float preferredRange,
                         const std::array<uint32, SPELLS_PER_BUCKET>& spells)
 {
+    RPGBOTS_PERF_SCOPE(PERF_RUN_MOBILITY);
+    s_traceBucket = TRACE_MOBILITY;
     if (!enemy) return false;
     // Only trigger if we're significantly farther than preferred range
     float dist = Dist2D(bot, enemy);
@@ -284,6 +367,8 @@ static bool RunMobility(Player* bot, Unit* enemy, float preferredRange,
 // Runs BEFORE the rotation waterfall — these are "free" throughput boosts.
 static bool RunMeta(Player* bot, Unit* enemy)
 {
+    RPGBOTS_PERF_SCOPE(PERF_RUN_META);
+    s_traceBucket = TRACE_META;
     // ── On-Use Trinkets ────────────────────────────────────────────────────
     for (uint8 slot : { EQUIPMENT_SLOT_TRINKET1, EQUIPMENT_SLOT_TRINKET2 })
     {
@@ -317,7 +402,9 @@ static bool RunMeta(Player* bot, Unit* enemy)
 
             // Positive = self-buff, negative = damage → target enemy
             Unit* target = info->IsPositive() ? bot : (enemy ? enemy : bot);
-            if (bot->CastSpell(target, spellId, false) == SPELL_CAST_OK)
+            SpellCastResult result = bot->CastSpell(target, spellId, false);
+            Trace(spellId, target->GetGUID(), result == SPELL_CAST_OK ? TRACE_CAST : TRACE_CAST_FAILED, result);
+            if (result == SPELL_CAST_OK)
                 return true;
         }
     }
@@ -332,7 +419,9 @@ static bool RunMeta(Player* bot, Unit* enemy)
         if (!info) continue;
 
         Unit* target = info->IsPositive() ? bot : (enemy ? enemy : bot);
-        if (bot->CastSpell(target, racialId, false) == SPELL_CAST_OK)
+        SpellCastResult result = bot->CastSpell(target, racialId, false);
+        Trace(racialId, target->GetGUID(), result == SPELL_CAST_OK ? TRACE_CAST : TRACE_CAST_FAILED, result);
+        if (result == SPELL_CAST_OK)
             return true;
     }
 
@@ -344,7 +433,7 @@ static bool RunMeta(Player* bot, Unit* enemy)
 // pair that would fire if the bot were free to cast right now.
 
 static bool ScanWaterfall(Player* bot, Player* master, Unit* enemy,
-                          const SpecRotation* rot,
+                          const SpecRotation* rot, TraitModifiers const& mods,
                           uint32& outSpellId, ObjectGuid& outTargetGuid)
 {
     // 1. Buffs
@@ -366,7 +455,7 @@ static bool ScanWaterfall(Player* bot, Player* master, Unit* enemy,
     }
 
     // 2. Defensives
-    if (bot->GetHealthPct() < DEFENSIVE_HP_PCT)
+    if (bot->GetHealthPct() < DEFENSIVE_HP_PCT + mods.defensiveHpOffset)
     {
         for (uint32 id : rot->defensives)
         {
@@ -419,7 +508,7 @@ static bool ScanWaterfall(Player* bot, Player* master, Unit* enemy,
     if (rot->role == BotRole::ROLE_HEALER)
     {
         Player* healTarget = FindLowestHP(bot, master);
-        if (healTarget && healTarget->GetHealthPct() < HEAL_THRESHOLD_PCT)
+        if (healTarget && healTarget->GetHealthPct() < HEAL_THRESHOLD_PCT + mods.healThresholdOffset)
         {
             for (uint32 id : rot->abilities)
             {
@@ -475,7 +564,8 @@ static bool ScanWaterfall(Player* bot, Player* master, Unit* enemy,
 // When free: consumes the queue first, then falls through to normal waterfall.
 
 static void RunWaterfall(Player* bot, Player* master, Unit* enemy,
-                         const SpecRotation* rot, BotInfo& info)
+                         const SpecRotation* rot, BotInfo& info, bool rotationMisfire,
+                         TraitModifiers const& mods, uint8 buckets)
 {
     // ── Currently casting or channeling — queue next spell, don't interrupt ──
     if (bot->HasUnitState(UNIT_STATE_CASTING))
@@ -485,10 +575,12 @@ static void RunWaterfall(Player* bot, Player* master, Unit* enemy,
         {
             uint32 qSpell = 0;
             ObjectGuid qTarget;
-            if (ScanWaterfall(bot, master, enemy, rot, qSpell, qTarget))
+            if (ScanWaterfall(bot, master, enemy, rot, mods, qSpell, qTarget))
             {
                 info.queuedSpellId    = qSpell;
                 info.queuedTargetGuid = qTarget;
+                s_traceBucket = TRACE_QUEUE;
+                Trace(qSpell, qTarget, TRACE_QUEUED);
             }
         }
         return;
@@ -502,43 +594,47 @@ static void RunWaterfall(Player* bot, Player* master, Unit* enemy,
         info.queuedSpellId = 0;
         info.queuedTargetGuid = ObjectGuid::Empty;
 
+        s_traceBucket = TRACE_QUEUE;
         Unit* target = ObjectAccessor::GetUnit(*bot, qTarget);
         if (target && target->IsAlive() && target->IsInWorld())
         {
             if (TryCast(bot, target, qSpell))
                 return;
         }
+        else
+            Trace(qSpell, qTarget, TRACE_QUEUE_EXPIRED);
         // Queue expired or invalid — fall through to normal waterfall
     }
 
     // ── Normal waterfall ───────────────────────────────────────────────────
 
     // 0. Meta — "Pop trinkets & racials"
-    if (RunMeta(bot, enemy))
+    if ((buckets & BUCKET_META) && RunMeta(bot, enemy))
         return;
 
     // 1. Buffs — "Is my tax paid?"
-    if (RunBuffs(bot, rot->buffs))
+    if ((buckets & BUCKET_BUFFS) && RunBuffs(bot, rot->buffs))
         return;
 
     // 2. Defensives — "Am I dying?"
-    if (RunDefensives(bot, rot->defensives))
+    if ((buckets & BUCKET_DEFENSIVES) && RunDefensives(bot, rot->defensives, mods))
         return;
 
-    // 3. DoTs — "Are my DoTs ticking?"
-    if (RunDots(bot, enemy, rot->dots))
+    // 3. DoTs — "Are my DoTs ticking?"  (skipped on a failed Rotation roll)
+    if ((buckets & BUCKET_DOTS) && !rotationMisfire && RunDots(bot, enemy, rot->dots))
         return;
 
     // 4. HoTs — "Are my HoTs rolling?"
-    if (RunHots(bot, master, rot->hots))
+    if ((buckets & BUCKET_HOTS) && RunHots(bot, master, rot->hots))
         return;
 
     // 5. Abilities — "What do I press?"
-    if (RunAbilities(bot, master, enemy, rot->role, rot->abilities))
+    if ((buckets & BUCKET_ABILITIES) && RunAbilities(bot, master, enemy, rot->role, rot->abilities, mods))
         return;
 
     // 6. Mobility — "Can I get in range?"
-    RunMobility(bot, enemy, rot->preferredRange, rot->mobility);
+    if (buckets & BUCKET_MOBILITY)
+        RunMobility(bot, enemy, rot->preferredRange, rot->mobility);
 }
 
 // ─── Arrow Formation ───────────────────────────────────────────────────────────
@@ -553,6 +649,7 @@ static void RunWaterfall(Player* bot, Player* master, Unit* enemy,
 
 static void ArrangeArrowFormation(Player* master, std::vector<BotInfo>& bots)
 {
+    RPGBOTS_PERF_SCOPE(PERF_FORMATION);
     if (bots.empty()) return;
 
     float masterX = master->GetPositionX();
@@ -623,17 +720,85 @@ static void ArrangeArrowFormation(Player* master, std::vector<BotInfo>& bots)
     placeRow(wings, wingDist);
 }
 
+// ─── Line Formation ────────────────────────────────────────────────────────────
+// One row abreast behind the master, tanks in the middle, healers at the ends.
+
+static void ArrangeLineFormation(Player* master, std::vector<BotInfo>& bots)
+{
+    RPGBOTS_PERF_SCOPE(PERF_FORMATION);
+    std::vector<BotInfo*> row;
+    for (auto& info : bots)
+        if (info.player && info.player->IsAlive() && info.player->IsInWorld()
+            && info.player->GetMapId() == master->GetMapId())
+            row.push_back(&info);
+    if (row.empty()) return;
+
+    std::stable_sort(row.begin(), row.end(), [](BotInfo const* a, BotInfo const* b)
+    {
+        return uint8(a->role) < uint8(b->role);   // tank, healer, melee, ranged
+    });
+
+    float facing  = master->GetOrientation();
+    float behind  = facing + float(M_PI);
+    float side    = facing + float(M_PI) * 0.5f;  // left of the master
+    float rowDist = 4.0f;
+    float spacing = 2.5f;
+
+    // Centre-out: 0, +1, -1, +2, -2 ... so the first bots stand in the middle
+    for (size_t i = 0; i < row.size(); ++i)
+    {
+        float offset = float((i + 1) / 2) * spacing * ((i % 2) ? 1.0f : -1.0f);
+        float x = master->GetPositionX() + rowDist * std::cos(behind) + offset * std::cos(side);
+        float y = master->GetPositionY() + rowDist * std::sin(behind) + offset * std::sin(side);
+
+        Player* bot = row[i]->player;
+        float dx = bot->GetPositionX() - x;
+        float dy = bot->GetPositionY() - y;
+        if (std::sqrt(dx * dx + dy * dy) > 3.0f)
+        {
+            row[i]->isFollowing = false;
+            bot->GetMotionMaster()->Clear();
+            bot->GetMotionMaster()->MovePoint(0, x, y, master->GetPositionZ());
+        }
+    }
+}
+
+// ─── Follow "Formation" ────────────────────────────────────────────────────────
+// Plain core following, fanned out behind the master; no per-tick slot checks.
+
+static void ArrangeFollow(Player* master, std::vector<BotInfo>& bots)
+{
+    RPGBOTS_PERF_SCOPE(PERF_FORMATION);
+    for (size_t i = 0; i < bots.size(); ++i)
+    {
+        BotInfo& info = bots[i];
+        if (info.isFollowing || !info.player || !info.player->IsAlive() || !info.player->IsInWorld())
+            continue;
+
+        float angle = float(M_PI) + (float(i % 5) - 2.0f) * 0.4f;
+        info.player->GetMotionMaster()->Clear();
+        info.player->GetMotionMaster()->MoveFollow(master, 3.0f + float(i / 5) * 2.0f, angle);
+        info.isFollowing = true;
+    }
+}
+
 // ─── Per-Bot Update ────────────────────────────────────────────────────────────
 
-static void UpdateBotAI(BotInfo& info, Player* master)
+static void UpdateBotAI(BotInfo& info, Player* master, bool rotationMisfire, uint8 buckets)
 {
+    RPGBOTS_PERF_SCOPE(PERF_UPDATE_BOT_AI);
     Player* bot = info.player;
     if (!bot || !bot->IsInWorld() || !bot->IsAlive()) return;
     if (!master || !master->IsInWorld()) return;
 
+    TraceScope traceScope(info.trace);
+
     const SpecRotation* rot = sRotationEngine.GetRotation(
         bot->getClass(), info.specIndex);
 
+    // Compiled temperament/psychology block — no aura probes on this path
+    TraitModifiers const& mods = sProfileStore.GetModifiers(bot->GetGUID().GetCounter());
+
     // ── Resolve enemy target ───────────────────────────────────────────────
     Unit* enemy = master->GetVictim();
     if (!enemy) enemy = master->GetSelectedUnit();
@@ -644,6 +809,18 @@ static void UpdateBotAI(BotInfo& info, Player* master)
     if (masterInCombat && enemy && enemy->IsAlive() &&
         enemy->IsInWorld() && !enemy->IsPlayer())
     {
+        // Reaction delay: a new fight is only picked up after the delay
+        if (!info.isInCombat && mods.reactionDelayMs)
+        {
+            if (!info.reactStartMs)
+                info.reactStartMs = getMSTime();
+            if (getMSTimeDiff(info.reactStartMs, getMSTime()) < mods.reactionDelayMs)
+            {
+                Trace(0, enemy, TRACE_REACTING);
+                return;
+            }
+        }
+
         if (!info.isInCombat || bot->GetVictim() != enemy)
         {
             info.isInCombat  = true;
@@ -670,14 +847,20 @@ static void UpdateBotAI(BotInfo& info, Player* master)
 
         // Run the waterfall
         if (rot)
-            RunWaterfall(bot, master, enemy, rot, info);
+            RunWaterfall(bot, master, enemy, rot, info, rotationMisfire, mods, buckets);
 
         return;
     }
 
+    // The master is fighting but gives us nothing to attack (dead, a player, none)
+    if (masterInCombat)
+        Trace(0, enemy, TRACE_NO_TARGET);
+
     // ── Out of combat ──────────────────────────────────────────────────────
     // Don't cast buffs out of combat — saves cooldowns for actual fights
 
+    info.reactStartMs = 0;
+
     // ── Leave-combat transition ────────────────────────────────────────────
     if (info.isInCombat)
     {
@@ -706,31 +889,77 @@ public:
 
     void OnUpdate(uint32 diff) override
     {
-        _timer += diff;
-        if (_timer < AI_UPDATE_INTERVAL_MS) return;
-        _timer = 0;
-
         auto& all = sBotMgr.GetAll();
-        if (all.empty()) return;
 
-        for (auto& [masterLow, bots] : all)
+        // Each second every army is queued once; armies the tick budget
+        // could not reach stay queued and run first on the next world tick
+        _timer += diff;
+        if (_timer >= AI_UPDATE_INTERVAL_MS)
         {
+            _timer = 0;
+            _queue.Refill(all, getMSTime());
+        }
+
+        ObjectGuid::LowType masterLow;
+        while (_queue.Next(masterLow))
+        {
+            auto armyIt = all.find(masterLow);
+            if (armyIt == all.end()) continue;   // dismissed while queued
+            std::vector<BotInfo>& bots = armyIt->second;
+
+            BotBudgetCharge charge;
             ObjectGuid mg = ObjectGuid::Create<HighGuid::Player>(masterLow);
             Player* master = ObjectAccessor::FindPlayer(mg);
             if (!master || !master->IsInWorld()) continue;
 
+            // Idle master: the whole army sleeps until the next activity
+            if (sBotHibernation.Update(master, bots))
+                continue;
+
+            // Level of detail: how often and how much of this army's AI runs
+            BotLodTier tier;
+            if (!sBotLod.BeginTick(master, bots, tier))
+                continue;
+            uint8  buckets = BotLod::GetTierInfo(tier).buckets;
+            uint64 startUs = BotPerfNowUs();
+
+            // Rotation rolls for the whole army in one pass (bit i = bots[i])
+            uint64 rotationOk = ~uint64(0);
+            if (RPGBotsConfig::RollRotationMisfire && master->IsInCombat())
+            {
+                _rollGuids.clear();
+                for (auto const& info : bots)
+                    _rollGuids.push_back(info.player ? info.player->GetGUID().GetCounter() : 0);
+                rotationOk = sRollEngine.RollGroup(_rollGuids.data(), uint32(_rollGuids.size()),
+                    PROFILE_STAT_ROTATION);
+            }
+
             // Per-bot AI updates (combat rotation, targeting)
-            for (auto& info : bots)
-                UpdateBotAI(info, master);
+            for (size_t i = 0; i < bots.size(); ++i)
+            {
+                bool misfire = i < ROLL_MAX_GROUP && !(rotationOk & (uint64(1) << i));
+                UpdateBotAI(bots[i], master, misfire, buckets);
+            }
 
-            // Out-of-combat: arrange arrow formation
+            // Out-of-combat: arrange the master's formation
             if (!master->IsInCombat())
-                ArrangeArrowFormation(master, bots);
+            {
+                switch (sBotMgr.GetFormation(masterLow))
+                {
+                    case BotFormation::FORMATION_LINE:   ArrangeLineFormation(master, bots);  break;
+                    case BotFormation::FORMATION_FOLLOW: ArrangeFollow(master, bots);         break;
+                    default:                             ArrangeArrowFormation(master, bots); break;
+                }
+            }
+
+            sBotLod.Record(tier, uint32(bots.size()), BotPerfNowUs() - startUs);
         }
     }
 
 private:
     uint32 _timer = 0;
+    BotTickQueue _queue;                           // armies due, in round-robin order
+    std::vector<ObjectGuid::LowType> _rollGuids;   // reused every tick
 };
 
 void AddBotAI()
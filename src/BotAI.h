@@ -6,10 +6,17 @@
 
 #include "Player.h"
 #include "BotBehavior.h"
+#include <array>
+#include <atomic>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <optional>
 
+static constexpr uint8 BOT_NO_OVERRIDE = 0xFF;
+
+class BotTraceRing;
+
 // ─── Extended Bot Entry (replaces the simple struct in ArmyOfAlts) ─────────────
 struct BotInfo
 {
@@ -23,6 +30,19 @@ struct BotInfo
     // Spell queue: when casting/channeling, the next spell to cast is queued
     uint32        queuedSpellId  = 0;
     ObjectGuid    queuedTargetGuid;
+
+    // When the bot first saw the current fight (temperament reaction delay)
+    uint32        reactStartMs   = 0;
+
+    // Manual overrides, persisted in army_roster (BOT_NO_OVERRIDE = detect)
+    uint8         roleOverride   = BOT_NO_OVERRIDE;
+    uint8         specOverride   = BOT_NO_OVERRIDE;
+
+    // Army asleep while the master idles (see BotHibernation)
+    bool          hibernating    = false;
+
+    // Recent waterfall decisions, owned by BotDecisionTrace (nullptr = off)
+    BotTraceRing* trace          = nullptr;
 };
 
 // ─── Bot Manager Singleton ─────────────────────────────────────────────────────
@@ -40,6 +60,8 @@ public:
     // Register a newly spawned bot
     void AddBot(ObjectGuid::LowType masterGuid, BotInfo info)
     {
+        if (info.player)
+            TrackBot(info.player->GetGUID().GetCounter());
         _bots[masterGuid].push_back(info);
     }
 
@@ -51,9 +73,32 @@ public:
             return {};
         auto bots = std::move(it->second);
         _bots.erase(it);
+        for (auto const& info : bots)
+            if (info.player)
+                UntrackBot(info.player->GetGUID().GetCounter());
         return bots;
     }
 
+    // O(1) check whether a character is a spawned bot.  World thread.
+    bool IsBot(ObjectGuid::LowType botGuid) const
+    {
+        return _botGuids.count(botGuid) > 0;
+    }
+
+    // Any thread, lock-free.  False means certainly not a bot; true may be a
+    // real player sharing a filter slot, so confirm with IsBot on the world
+    // thread.  Lets map-thread hooks skip real players without a lock.
+    bool MayBeBot(ObjectGuid::LowType guid) const
+    {
+        return _botFilter[guid % BOT_FILTER_SLOTS].load(std::memory_order_relaxed) != 0;
+    }
+
+    // Number of live bots across every army on the realm
+    uint32 GetBotCount() const
+    {
+        return uint32(_botGuids.size());
+    }
+
     // Check if a master has any bots
     bool HasBots(ObjectGuid::LowType masterGuid) const
     {
@@ -108,6 +153,7 @@ public:
             if (vit->player && vit->player->GetName() == name)
             {
                 BotInfo info = *vit;
+                UntrackBot(info.player->GetGUID().GetCounter());
                 vec.erase(vit);
                 if (vec.empty())
                     _bots.erase(it);
@@ -117,9 +163,46 @@ public:
         return std::nullopt;
     }
 
+    // Out-of-combat formation per master (arrow until set)
+    BotFormation GetFormation(ObjectGuid::LowType masterGuid) const
+    {
+        auto it = _formations.find(masterGuid);
+        return it != _formations.end() ? it->second : BotFormation::FORMATION_ARROW;
+    }
+
+    void SetFormation(ObjectGuid::LowType masterGuid, BotFormation formation)
+    {
+        _formations[masterGuid] = formation;
+    }
+
+    // Master logged out (the roster keeps the persisted copy)
+    void ForgetFormation(ObjectGuid::LowType masterGuid)
+    {
+        _formations.erase(masterGuid);
+    }
+
 private:
     BotManager() = default;
     std::unordered_map<ObjectGuid::LowType, std::vector<BotInfo>> _bots;
+    std::unordered_map<ObjectGuid::LowType, BotFormation> _formations;
+    std::unordered_set<ObjectGuid::LowType> _botGuids;
+
+    // Counting filter over _botGuids for MayBeBot: live bots per slot,
+    // written by the world thread only
+    static constexpr uint32 BOT_FILTER_SLOTS = 16384;
+    std::array<std::atomic<uint16>, BOT_FILTER_SLOTS> _botFilter{};
+
+    void TrackBot(ObjectGuid::LowType guid)
+    {
+        if (_botGuids.insert(guid).second)
+            _botFilter[guid % BOT_FILTER_SLOTS].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void UntrackBot(ObjectGuid::LowType guid)
+    {
+        if (_botGuids.erase(guid))
+            _botFilter[guid % BOT_FILTER_SLOTS].fetch_sub(1, std::memory_order_relaxed);
+    }
 };
 
 #define sBotMgr BotManager::Instance()
@@ -130,3 +213,6 @@ BotRole DetectBotRole(Player* bot);
 
 // Returns the spec index into the class profile based on talent tree
 uint8 DetectSpecIndex(Player* bot);
+
+// Re-detect role and spec after a talent change, keeping manual overrides
+void RefreshRoleAndSpec(BotInfo& info);
@@ -1,5 +1,5 @@
 // BotBehavior.h
-// Role enum and role-name helper used across the bot system.
+// Role and formation enums and name helpers used across the bot system.
 
 #pragma once
 
@@ -15,6 +15,26 @@ enum class BotRole : uint8
     ROLE_RANGED_DPS = 3,
 };
 
+// ─── Formations (out of combat) ────────────────────────────────────────────────
+enum class BotFormation : uint8
+{
+    FORMATION_ARROW  = 0,   // tanks at the tip, melee, then ranged/healer wings
+    FORMATION_LINE   = 1,   // one row abreast behind the master
+    FORMATION_FOLLOW = 2,   // plain follow, no slot placement
+    MAX_FORMATIONS
+};
+
+inline const char* BotFormationName(BotFormation formation)
+{
+    switch (formation)
+    {
+        case BotFormation::FORMATION_ARROW:  return "arrow";
+        case BotFormation::FORMATION_LINE:   return "line";
+        case BotFormation::FORMATION_FOLLOW: return "follow";
+        default:                             return "unknown";
+    }
+}
+
 inline const char* BotRoleName(BotRole role)
 {
     switch (role)
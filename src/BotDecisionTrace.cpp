@@ -0,0 +1,163 @@
+// BotDecisionTrace.cpp
+// Ring allocation, formatting and `.army trace`.  See BotDecisionTrace.h.
+
+#include "BotDecisionTrace.h"
+#include "BotAI.h"
+#include "Chat.h"
+#include "CommandScript.h"
+#include "Config.h"
+#include "Player.h"
+#include "RPGBotsConfig.h"
+#include "ScriptMgr.h"
+#include "SpellInfo.h"
+#include "SpellMgr.h"
+#include "StringFormat.h"
+#include "Timer.h"
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+
+// ─── Rings ─────────────────────────────────────────────────────────────────────
+BotTraceRing* BotDecisionTrace::Acquire(ObjectGuid::LowType botLow)
+{
+    if (!RPGBotsConfig::TraceEntries)
+        return nullptr;
+
+    return &_rings.try_emplace(botLow, RPGBotsConfig::TraceEntries).first->second;
+}
+
+char const* BotDecisionTrace::BucketName(uint8 bucket)
+{
+    switch (bucket)
+    {
+        case TRACE_TARGET:     return "Target";
+        case TRACE_QUEUE:      return "Queue";
+        case TRACE_META:       return "Meta";
+        case TRACE_BUFFS:      return "Buffs";
+        case TRACE_DEFENSIVES: return "Defensives";
+        case TRACE_DOTS:       return "DoTs";
+        case TRACE_HOTS:       return "HoTs";
+        case TRACE_ABILITIES:  return "Abilities";
+        case TRACE_MOBILITY:   return "Mobility";
+        default:               return "?";
+    }
+}
+
+char const* BotDecisionTrace::OutcomeName(uint8 outcome)
+{
+    switch (outcome)
+    {
+        case TRACE_CAST:          return "cast";
+        case TRACE_CAST_FAILED:   return "cast failed";
+        case TRACE_NOT_KNOWN:     return "spell not known";
+        case TRACE_COOLDOWN:      return "on cooldown";
+        case TRACE_NO_REAGENT:    return "missing reagent";
+        case TRACE_LOW_MANA:      return "mana below threshold";
+        case TRACE_AURA_PRESENT:  return "aura already up";
+        case TRACE_NO_TARGET:     return "no valid target";
+        case TRACE_REACTING:      return "reaction delay";
+        case TRACE_QUEUED:        return "queued";
+        case TRACE_QUEUE_EXPIRED: return "queued target gone";
+        default:                  return "?";
+    }
+}
+
+std::string BotDecisionTrace::Format(BotTraceEntry const& entry, uint32 nowMs)
+{
+    std::string spell = "-";
+    if (entry.spellId)
+    {
+        SpellInfo const* info = sSpellMgr->GetSpellInfo(entry.spellId);
+        spell = Acore::StringFormat("{} ({})", info ? info->SpellName[0] : "?", entry.spellId);
+    }
+
+    std::string outcome = OutcomeName(entry.outcome);
+    if (entry.outcome == TRACE_CAST_FAILED)
+        outcome += Acore::StringFormat(" (SpellCastResult {})", entry.castResult);
+
+    return Acore::StringFormat("tick {} (-{:.1f}s) {:<10} {} -> {}: {}",
+        entry.tick, float(getMSTimeDiff(entry.timeMs, nowMs)) / 1000.0f, BucketName(entry.bucket), spell,
+        entry.target.IsEmpty() ? "-" : entry.target.ToString(), outcome);
+}
+
+// ─── .army trace — recent decisions of one bot ─────────────────────────────────
+class BotDecisionTraceCommands : public CommandScript
+{
+public:
+    BotDecisionTraceCommands() : CommandScript("BotDecisionTraceCommands") {}
+
+    ChatCommandTable GetCommands() const override
+    {
+        static ChatCommandTable armyTable =
+        {
+            { "trace", HandleTraceCmd, SEC_GAMEMASTER, Console::No },
+        };
+        static ChatCommandTable topTable =
+        {
+            { "army", armyTable },
+        };
+        return topTable;
+    }
+
+    // .army trace <name> [n] [file]
+    static bool HandleTraceCmd(ChatHandler* handler, std::string name, Optional<uint32> countArg,
+                               Optional<std::string> fileArg)
+    {
+        Player* master = handler->GetSession()->GetPlayer();
+        if (!master) return false;
+
+        BotInfo* info = sBotMgr.FindBot(master->GetGUID().GetCounter(), name);
+        if (!info || !info->player)
+        {
+            handler->PSendSysMessage("|cffff0000No bot named '{}' found.|r", name);
+            return true;
+        }
+
+        BotTraceRing const* ring = info->trace;
+        if (!ring)
+        {
+            handler->PSendSysMessage("|cffff0000[Army] Decision trace is off (RPGBots.Trace.Entries = 0).|r");
+            return true;
+        }
+
+        // The typed name may differ in case; use the character's own name so
+        // one bot's dumps always land under one file name
+        std::string const& botName = info->player->GetName();
+        uint32 count = std::min(countArg.value_or(20), ring->Size());
+        uint32 now   = getMSTime();
+
+        if (fileArg && *fileArg == "file")
+        {
+            std::string dir = sConfigMgr->GetOption<std::string>("LogsDir", "");
+            if (!dir.empty() && dir.back() != '/' && dir.back() != '\\')
+                dir += '/';
+            std::string path = Acore::StringFormat("{}rpgbots_trace_{}_{}.log", dir, botName, uint64(std::time(nullptr)));
+
+            std::ofstream out(path);
+            if (!out)
+            {
+                handler->PSendSysMessage("|cffff0000[Army] Could not open {}.|r", path);
+                return true;
+            }
+
+            // Oldest first, like any log
+            out << "Decision trace for " << botName << " (" << count << " of " << ring->Size() << " entries)\n";
+            for (uint32 i = count; i-- > 0; )
+                out << BotDecisionTrace::Format(ring->Recent(i), now) << '\n';
+
+            handler->PSendSysMessage("|cff00ff00[Army] Wrote {} trace entries for {} to {}.|r", count, botName, path);
+            return true;
+        }
+
+        handler->PSendSysMessage("|cff00ff00=== Decision trace for {} ({} of {}, newest first) ===|r",
+            botName, count, ring->Size());
+        for (uint32 i = 0; i < count; ++i)
+            handler->PSendSysMessage("  {}", BotDecisionTrace::Format(ring->Recent(i), now));
+        return true;
+    }
+};
+
+void AddBotDecisionTrace()
+{
+    new BotDecisionTraceCommands();
+}
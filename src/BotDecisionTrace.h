@@ -0,0 +1,127 @@
+// BotDecisionTrace.h
+// Per-bot ring of recent waterfall decisions — "why did my bot do nothing?"
+//
+// Every spell the waterfall tries or passes over is recorded with the world
+// tick, bucket, spell, target and outcome: cast, the SpellCastResult when
+// CastSpell refused, or why it was never tried (not known, on cooldown,
+// aura already up, missing reagent, not enough mana).  A fight the bot
+// cannot join (no valid target, still reacting) is recorded too.
+//
+// Each bot's ring holds the last RPGBots.Trace.Entries decisions.  It is
+// allocated once when the bot spawns and overwritten in place, so recording
+// on the AI path is a struct copy — no allocation, no lookup.
+//
+//     .army trace <name> [n]        newest n entries to chat
+//     .army trace <name> [n] file   same, written to the logs directory
+//
+// World thread only.
+
+#pragma once
+
+#include "ObjectGuid.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+enum BotTraceBucket : uint8
+{
+    TRACE_TARGET,        // enemy resolution in UpdateBotAI
+    TRACE_QUEUE,         // spell queued while casting
+    TRACE_META,
+    TRACE_BUFFS,
+    TRACE_DEFENSIVES,
+    TRACE_DOTS,
+    TRACE_HOTS,
+    TRACE_ABILITIES,
+    TRACE_MOBILITY,
+    MAX_TRACE_BUCKETS
+};
+
+enum BotTraceOutcome : uint8
+{
+    TRACE_CAST,           // CastSpell returned SPELL_CAST_OK
+    TRACE_CAST_FAILED,    // CastSpell refused — see castResult
+    TRACE_NOT_KNOWN,      // bot does not have the spell
+    TRACE_COOLDOWN,
+    TRACE_NO_REAGENT,
+    TRACE_LOW_MANA,
+    TRACE_AURA_PRESENT,   // buff / DoT / HoT already up
+    TRACE_NO_TARGET,
+    TRACE_REACTING,       // waiting out the temperament reaction delay
+    TRACE_QUEUED,         // picked mid-cast, fires when the cast ends
+    TRACE_QUEUE_EXPIRED,  // queued target gone or dead
+    MAX_TRACE_OUTCOMES
+};
+
+struct BotTraceEntry
+{
+    uint64     tick;         // world tick (BotTickBudget)
+    uint32     timeMs;       // getMSTime()
+    uint32     spellId;
+    ObjectGuid target;
+    uint8      bucket;       // BotTraceBucket
+    uint8      outcome;      // BotTraceOutcome
+    uint8      castResult;   // SpellCastResult, for TRACE_CAST_FAILED
+};
+
+// Fixed-capacity ring, sized once at construction
+class BotTraceRing
+{
+public:
+    explicit BotTraceRing(uint32 capacity) : _entries(capacity) { }
+
+    void Push(BotTraceEntry const& entry)
+    {
+        _entries[_head] = entry;
+        _head = (_head + 1) % uint32(_entries.size());
+        if (_count < _entries.size())
+            ++_count;
+    }
+
+    uint32 Size()     const { return _count; }
+    uint32 Capacity() const { return uint32(_entries.size()); }
+
+    // 0 = newest
+    BotTraceEntry const& Recent(uint32 i) const
+    {
+        uint32 cap = uint32(_entries.size());
+        return _entries[(_head + cap - 1 - i) % cap];
+    }
+
+private:
+    std::vector<BotTraceEntry> _entries;
+    uint32 _head  = 0;
+    uint32 _count = 0;
+};
+
+class BotDecisionTrace
+{
+public:
+    static BotDecisionTrace& Instance()
+    {
+        static BotDecisionTrace instance;
+        return instance;
+    }
+
+    // Bot spawned: its ring (nullptr when tracing is off)
+    BotTraceRing* Acquire(ObjectGuid::LowType botLow);
+
+    // Bot dismissed
+    void Release(ObjectGuid::LowType botLow) { _rings.erase(botLow); }
+
+    static char const* BucketName(uint8 bucket);
+    static char const* OutcomeName(uint8 outcome);
+
+    // "tick 1234 (-2.5s) DoTs      Corruption (172) -> Creature ...: on cooldown"
+    static std::string Format(BotTraceEntry const& entry, uint32 nowMs);
+
+private:
+    BotDecisionTrace() = default;
+
+    std::unordered_map<ObjectGuid::LowType, BotTraceRing> _rings;
+};
+
+#define sBotDecisionTrace BotDecisionTrace::Instance()
+
+// Registration
+void AddBotDecisionTrace();
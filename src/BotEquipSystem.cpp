@@ -1,21 +1,29 @@
 // BotEquipSystem.cpp
 // Equipment management for bot alts:
-//   .army equip <name>   — Auto-equip best items from bags (by item level)
-//   .army gear  <name>   — Show currently equipped gear
+//   .army equip <name|all>             — Auto-equip best items from bags (spec stat weights)
+//   .army gear  <name>                 — Show currently equipped gear
+//   .army equipbench <name> [count]    — Time the auto-equip planner (no swaps, max 200 runs / 5 ms)
 //
 // Master Loot works natively: bots are real Player objects in the group,
 // so the master can assign loot items to them just like normal players.
-// After assigning loot, use `.army equip <name>` to auto-equip upgrades.
+// After assigning loot, use `.army equip <name>` to auto-equip upgrades,
+// or enable RPGBots.Equip.OnAcquire to equip them as they arrive.
 
 #include "ScriptMgr.h"
 #include "Chat.h"
 #include "CommandScript.h"
 #include "Player.h"
 #include "BotAI.h"
+#include "BotItemScore.h"
+#include "BotProfiler.h"
+#include "BotSaveScheduler.h"
+#include "RPGBotsConfig.h"
 #include "Item.h"
 #include "ItemTemplate.h"
 #include "Bag.h"
+#include "Group.h"
 #include <algorithm>
+#include <mutex>
 #include <vector>
 
 using namespace Acore::ChatCommands;
@@ -62,26 +70,6 @@ namespace
         }
     }
 
-    // Item level of whatever is currently in an equipment slot (0 if empty)
-    uint32 EquippedILvl(Player* bot, uint8 slot)
-    {
-        Item* item = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, slot);
-        if (!item || !item->GetTemplate()) return 0;
-        return item->GetTemplate()->ItemLevel;
-    }
-
-    // For dual-slot items: pick the slot with the lower iLvl (or an empty one)
-    uint8 BestDualSlot(Player* bot, uint8 s1, uint8 s2, uint32 newILvl)
-    {
-        uint32 i1 = EquippedILvl(bot, s1);
-        uint32 i2 = EquippedILvl(bot, s2);
-        if (i1 == 0) return s1;
-        if (i2 == 0) return s2;
-        uint8 weaker    = (i1 <= i2) ? s1 : s2;
-        uint32 weakILvl = std::min(i1, i2);
-        return (newILvl > weakILvl) ? weaker : NO_SLOT;
-    }
-
     // ─── Slot display names ───────────────────────────────────────────────
     const char* SlotName(uint8 slot)
     {
@@ -110,84 +98,349 @@ namespace
         }
     }
 
-    // ─── Auto-equip: scan bags, equip any item-level upgrades ─────────────
-    // Re-scans after each equip to avoid stale positions.
-    uint32 DoAutoEquip(Player* bot, ChatHandler* handler)
+    // Score of whatever is in an equipment slot (-1 if empty)
+    float EquippedScore(Player* bot, ItemScoreProfile const& profile, uint8 slot)
     {
-        uint32 total = 0;
-        bool changed = true;
+        Item* item = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, slot);
+        if (!item || !item->GetTemplate()) return -1.0f;
+        return sBotItemScore.Score(profile, item->GetTemplate());
+    }
+
+    // ─── Single-pass auto-equip ───────────────────────────────────────────
+    // Bags are scanned once and every usable item is grouped by slot: the
+    // best per single slot, the best two per dual slot (rings, trinkets), and
+    // the weapon candidates.  Weapons are resolved together: the best
+    // two-hander against the best main hand + off hand pair.  The plan is
+    // then executed in one batch of swaps, main hand before off hand.
+    struct Scored
+    {
+        Item* item  = nullptr;
+        float score = -1.0f;
+    };
+
+    struct EquipMove
+    {
+        Item* item;
+        uint8 slot;
+        float score;
+    };
+
+    struct EquipPlan
+    {
+        std::vector<EquipMove> moves;
+        uint32 candidates = 0;   // usable bag items considered
+    };
+
+    enum DualGroup : uint8 { DUAL_FINGER, DUAL_TRINKET, MAX_DUAL_GROUPS };
+
+    void KeepBest(Scored& best, Item* item, float score)
+    {
+        if (score > best.score)
+            best = { item, score };
+    }
 
-        while (changed)
+    // `keepOnTie` lets an equipped item hold its place against an equal one
+    void KeepBestTwo(Scored (&top)[2], Item* item, float score, bool keepOnTie = false)
+    {
+        if (score > top[0].score || (keepOnTie && score == top[0].score))
         {
-            changed = false;
+            top[1] = top[0];
+            top[0] = { item, score };
+        }
+        else if (score > top[1].score || (keepOnTie && score == top[1].score))
+            top[1] = { item, score };
+    }
+
+    float PairScore(Scored const& a, Scored const& b)
+    {
+        return std::max(a.score, 0.0f) + std::max(b.score, 0.0f);
+    }
 
-            // Collect every item currently in bags
-            struct Candidate { Item* item; uint8 bag; uint8 slot; uint32 ilvl; };
-            std::vector<Candidate> cands;
+    template <typename Fn>
+    void ForEachBagItem(Player* bot, Fn&& fn)
+    {
+        for (uint8 s = INVENTORY_SLOT_ITEM_START; s < INVENTORY_SLOT_ITEM_END; ++s)
+            if (Item* it = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, s))
+                fn(it);
+        for (uint8 b = INVENTORY_SLOT_BAG_START; b < INVENTORY_SLOT_BAG_END; ++b)
+            if (Bag* bag = bot->GetBagByPos(b))
+                for (uint32 s = 0; s < bag->GetBagSize(); ++s)
+                    if (Item* it = bag->GetItemByPos(uint8(s)))
+                        fn(it);
+    }
 
-            // Main backpack
-            for (uint8 s = INVENTORY_SLOT_ITEM_START; s < INVENTORY_SLOT_ITEM_END; ++s)
-            {
-                Item* it = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, s);
-                if (it && it->GetTemplate())
-                    cands.push_back({ it, INVENTORY_SLOT_BAG_0, s, it->GetTemplate()->ItemLevel });
-            }
-            // Extra bags (slots 19-22)
-            for (uint8 b = INVENTORY_SLOT_BAG_START; b < INVENTORY_SLOT_BAG_END; ++b)
+    void PlanAutoEquip(BotInfo const& info, EquipPlan& plan)
+    {
+        Player* bot = info.player;
+        ItemScoreProfile profile = sBotItemScore.GetProfile(bot, info.specIndex, info.role);
+
+        plan.moves.clear();
+        plan.candidates = 0;
+
+        Scored single[EQUIPMENT_SLOT_END];
+        Scored dual[MAX_DUAL_GROUPS][2];
+        Scored twoHand, mainHand[2], offHand[2];   // top two: a one-hander may go in either hand
+        bool dualWield = bot->CanDualWield();
+
+        // ── One scan: group usable bag items by slot ───────────────────────
+        ForEachBagItem(bot, [&](Item* item)
+        {
+            ItemTemplate const* proto = item->GetTemplate();
+            if (!proto || bot->CanUseItem(item) != EQUIP_ERR_OK)
+                return;
+
+            float score = sBotItemScore.Score(profile, proto);
+            switch (proto->InventoryType)
             {
-                Bag* bag = bot->GetBagByPos(b);
-                if (!bag) continue;
-                for (uint8 s = 0; s < bag->GetBagSize(); ++s)
+                case INVTYPE_2HWEAPON:
+                    KeepBest(twoHand, item, score);
+                    break;
+                case INVTYPE_WEAPON:
+                    KeepBestTwo(mainHand, item, score);
+                    if (dualWield)
+                        KeepBestTwo(offHand, item, score);
+                    break;
+                case INVTYPE_WEAPONMAINHAND:
+                    KeepBestTwo(mainHand, item, score);
+                    break;
+                case INVTYPE_WEAPONOFFHAND:
+                    if (dualWield)
+                        KeepBestTwo(offHand, item, score);
+                    break;
+                case INVTYPE_SHIELD:
+                case INVTYPE_HOLDABLE:
+                    KeepBestTwo(offHand, item, score);
+                    break;
+                case INVTYPE_FINGER:
+                    KeepBestTwo(dual[DUAL_FINGER], item, score);
+                    break;
+                case INVTYPE_TRINKET:
+                    KeepBestTwo(dual[DUAL_TRINKET], item, score);
+                    break;
+                default:
                 {
-                    Item* it = bot->GetItemByPos(b, s);
-                    if (it && it->GetTemplate())
-                        cands.push_back({ it, b, s, it->GetTemplate()->ItemLevel });
+                    uint8 s1, s2;
+                    InvTypeToSlots(proto->InventoryType, s1, s2);
+                    if (s1 == NO_SLOT)
+                        return;
+                    KeepBest(single[s1], item, score);
+                    break;
                 }
             }
+            ++plan.candidates;
+        });
+
+        // ── Single slots ───────────────────────────────────────────────────
+        for (uint8 slot = EQUIPMENT_SLOT_START; slot < EQUIPMENT_SLOT_END; ++slot)
+            if (single[slot].item && single[slot].score > EquippedScore(bot, profile, slot))
+                plan.moves.push_back({ single[slot].item, slot, single[slot].score });
 
-            // Best items first
-            std::sort(cands.begin(), cands.end(),
-                      [](auto& a, auto& b) { return a.ilvl > b.ilvl; });
+        // ── Dual slots: each upgrade replaces the weaker equipped one ─────
+        static uint8 const dualSlots[MAX_DUAL_GROUPS][2] =
+        {
+            { EQUIPMENT_SLOT_FINGER1,  EQUIPMENT_SLOT_FINGER2  },
+            { EQUIPMENT_SLOT_TRINKET1, EQUIPMENT_SLOT_TRINKET2 },
+        };
+        for (uint8 g = 0; g < MAX_DUAL_GROUPS; ++g)
+        {
+            float cur[2] = { EquippedScore(bot, profile, dualSlots[g][0]), EquippedScore(bot, profile, dualSlots[g][1]) };
+            for (Scored const& cand : dual[g])
+            {
+                uint8 weaker = cur[0] <= cur[1] ? 0 : 1;
+                if (!cand.item || cand.score <= cur[weaker])
+                    break;
+                plan.moves.push_back({ cand.item, dualSlots[g][weaker], cand.score });
+                cur[weaker] = cand.score;
+            }
+        }
 
-            for (auto& c : cands)
+        // ── Weapons: best two-hander vs best main hand + off hand ─────────
+        Item* eqMain = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, EQUIPMENT_SLOT_MAINHAND);
+        Item* eqOff  = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, EQUIPMENT_SLOT_OFFHAND);
+        if (eqMain && eqMain->GetTemplate())
+        {
+            float score = sBotItemScore.Score(profile, eqMain->GetTemplate());
+            if (eqMain->GetTemplate()->InventoryType == INVTYPE_2HWEAPON)
             {
-                ItemTemplate const* proto = c.item->GetTemplate();
-                if (!proto) continue;
+                if (score >= twoHand.score)
+                    twoHand = { eqMain, score };
+            }
+            else
+                KeepBestTwo(mainHand, eqMain, score, true);
+        }
+        if (eqOff && eqOff->GetTemplate())
+            KeepBestTwo(offHand, eqOff, sBotItemScore.Score(profile, eqOff->GetTemplate()), true);
+
+        // The same one-hander can't fill both hands
+        Scored pairMain = mainHand[0];
+        Scored pairOff  = offHand[0];
+        if (pairMain.item && pairMain.item == pairOff.item)
+        {
+            if (PairScore(mainHand[1], offHand[0]) > PairScore(mainHand[0], offHand[1]))
+                pairMain = mainHand[1];
+            else
+                pairOff  = offHand[1];
+        }
+        float pairScore = PairScore(pairMain, pairOff);
+
+        if (twoHand.item && twoHand.score > pairScore)
+        {
+            if (twoHand.item != eqMain)
+                plan.moves.push_back({ twoHand.item, EQUIPMENT_SLOT_MAINHAND, twoHand.score });
+        }
+        else
+        {
+            if (pairMain.item && pairMain.item != eqMain)
+                plan.moves.push_back({ pairMain.item, EQUIPMENT_SLOT_MAINHAND, pairMain.score });
+            if (pairOff.item && pairOff.item != eqOff)
+                plan.moves.push_back({ pairOff.item, EQUIPMENT_SLOT_OFFHAND, pairOff.score });
+        }
+    }
 
+    // ─── One new item against the slots it fits ──────────────────────────
+    // The incremental path: no bag scan, only the equipped items compete.
+    void PlanItemUpgrade(BotInfo const& info, Item* item, EquipPlan& plan)
+    {
+        plan.moves.clear();
+        plan.candidates = 0;
+
+        Player* bot = info.player;
+        ItemTemplate const* proto = item->GetTemplate();
+        if (!proto || item->IsEquipped() || bot->CanUseItem(item) != EQUIP_ERR_OK)
+            return;
+
+        ItemScoreProfile profile = sBotItemScore.GetProfile(bot, info.specIndex, info.role);
+        float score = sBotItemScore.Score(profile, proto);
+        plan.candidates = 1;
+
+        float mainScore = EquippedScore(bot, profile, EQUIPMENT_SLOT_MAINHAND);
+        float offScore  = EquippedScore(bot, profile, EQUIPMENT_SLOT_OFFHAND);
+        Item* eqMain    = bot->GetItemByPos(INVENTORY_SLOT_BAG_0, EQUIPMENT_SLOT_MAINHAND);
+        bool twoHanded  = eqMain && eqMain->GetTemplate()->InventoryType == INVTYPE_2HWEAPON;
+
+        switch (proto->InventoryType)
+        {
+            case INVTYPE_2HWEAPON:
+                if (score > PairScore({ nullptr, mainScore }, { nullptr, offScore }))
+                    plan.moves.push_back({ item, EQUIPMENT_SLOT_MAINHAND, score });
+                break;
+            case INVTYPE_WEAPON:
+            case INVTYPE_WEAPONMAINHAND:
+                if (score > mainScore)
+                    plan.moves.push_back({ item, EQUIPMENT_SLOT_MAINHAND, score });
+                else if (proto->InventoryType == INVTYPE_WEAPON && bot->CanDualWield()
+                         && !twoHanded && score > offScore)
+                    plan.moves.push_back({ item, EQUIPMENT_SLOT_OFFHAND, score });
+                break;
+            case INVTYPE_WEAPONOFFHAND:
+                if (!bot->CanDualWield())
+                    break;
+                [[fallthrough]];
+            case INVTYPE_SHIELD:
+            case INVTYPE_HOLDABLE:
+                if (!twoHanded && score > offScore)
+                    plan.moves.push_back({ item, EQUIPMENT_SLOT_OFFHAND, score });
+                break;
+            default:
+            {
                 uint8 s1, s2;
                 InvTypeToSlots(proto->InventoryType, s1, s2);
-                if (s1 == NO_SLOT) continue;
+                if (s1 == NO_SLOT)
+                    break;
 
-                uint8 target;
+                float cur = EquippedScore(bot, profile, s1);
                 if (s2 != NO_SLOT)
-                    target = BestDualSlot(bot, s1, s2, proto->ItemLevel);
-                else
                 {
-                    if (EquippedILvl(bot, s1) >= proto->ItemLevel)
-                        continue; // current is same or better
-                    target = s1;
+                    float cur2 = EquippedScore(bot, profile, s2);
+                    if (cur2 < cur)
+                    {
+                        s1  = s2;
+                        cur = cur2;
+                    }
                 }
-                if (target == NO_SLOT) continue;
-
-                // Validate the bot can actually wear this
-                uint16 dest;
-                if (bot->CanEquipItem(target, dest, c.item, true) != EQUIP_ERR_OK)
-                    continue;
+                if (score > cur)
+                    plan.moves.push_back({ item, s1, score });
+                break;
+            }
+        }
+    }
 
-                // Swap: bag item → equipment slot, old equipment → bag position
-                uint16 src = ((uint16)c.bag  << 8) | c.slot;
-                uint16 dst = ((uint16)INVENTORY_SLOT_BAG_0 << 8) | target;
-                bot->SwapItem(src, dst);
+    // Swaps touch only the two positions involved, so the items planned
+    // above stay where the scan found them until their own move.
+    uint32 ApplyEquipPlan(Player* bot, EquipPlan const& plan, ChatHandler* handler)
+    {
+        uint32 total = 0;
+        for (EquipMove const& move : plan.moves)
+        {
+            uint16 dest;
+            if (bot->CanEquipItem(move.slot, dest, move.item, true) != EQUIP_ERR_OK)
+                continue;   // unique-equipped, two-hander blocking the off hand, ...
 
-                handler->PSendSysMessage("  Equipped: {} (iLvl {}) → {}",
-                                         proto->Name1, proto->ItemLevel, SlotName(target));
-                ++total;
-                changed = true;
-                break; // re-scan after each equip
-            }
+            ItemTemplate const* proto = move.item->GetTemplate();
+            bot->SwapItem(move.item->GetPos(), dest);
+            if (handler)
+                handler->PSendSysMessage("  Equipped: {} (iLvl {}, score {:.1f}) → {}",
+                                         proto->Name1, proto->ItemLevel, move.score, SlotName(move.slot));
+            ++total;
         }
         return total;
     }
+
+    uint32 DoAutoEquip(BotInfo const& info, ChatHandler* handler)
+    {
+        EquipPlan plan;
+        PlanAutoEquip(info, plan);
+        return ApplyEquipPlan(info.player, plan, handler);
+    }
+
+    // ─── Acquired-item queue ─────────────────────────────────────────────
+    // Item hooks fire on map update threads and in the middle of the core's
+    // own item handling, so they only queue; the world tick filters bots
+    // (the bot registry is world-thread only) and equips.
+    std::mutex                                       _acquiredLock;
+    std::vector<std::pair<ObjectGuid, ObjectGuid>>   _acquired;   // bot, item
+
+    void QueueAcquired(Player* player, Item* item)
+    {
+        if (!RPGBotsConfig::EquipOnAcquire || !player || !item)
+            return;
+
+        // Lock-free pre-filter; ProcessAcquired confirms with IsBot
+        if (!sBotMgr.MayBeBot(player->GetGUID().GetCounter()))
+            return;
+
+        std::lock_guard<std::mutex> lock(_acquiredLock);
+        _acquired.emplace_back(player->GetGUID(), item->GetGUID());
+    }
+
+    void ProcessAcquired()
+    {
+        std::vector<std::pair<ObjectGuid, ObjectGuid>> pending;
+        {
+            std::lock_guard<std::mutex> lock(_acquiredLock);
+            if (_acquired.empty())
+                return;
+            pending.swap(_acquired);
+        }
+
+        EquipPlan plan;
+        for (auto const& [botGuid, itemGuid] : pending)
+        {
+            if (!sBotMgr.IsBot(botGuid.GetCounter()))
+                continue;   // a real player, or dismissed since
+
+            BotInfo* info = sBotMgr.FindBot(botGuid);
+            if (!info || !info->player)
+                continue;   // dismissed since
+            Item* item = info->player->GetItemByGuid(itemGuid);
+            if (!item)
+                continue;   // sold, traded or destroyed since
+
+            PlanItemUpgrade(*info, item, plan);
+            if (ApplyEquipPlan(info->player, plan, nullptr))
+                sBotSaveScheduler.MarkDirty(info->player);
+        }
+    }
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -202,6 +455,7 @@ public:
         {
             { "equip", HandleEquipCmd, SEC_GAMEMASTER, Console::No },
             { "gear",  HandleGearCmd,  SEC_GAMEMASTER, Console::No },
+            { "equipbench", HandleEquipBenchCmd, SEC_GAMEMASTER, Console::No },
         };
         static ChatCommandTable topTable =
         {
@@ -210,13 +464,45 @@ public:
         return topTable;
     }
 
-    // ─── .army equip <name> ────────────────────────────────────────────────
+    // ─── .army equip <name|all> ────────────────────────────────────────────
+    // `all` gears every bot in the army and commits the saves in one
+    // transaction with a single summary.
     static bool HandleEquipCmd(ChatHandler* handler, std::string name)
     {
         Player* master = handler->GetSession()->GetPlayer();
         if (!master) return false;
 
-        BotInfo* info = sBotMgr.FindBot(master->GetGUID().GetCounter(), name);
+        ObjectGuid::LowType masterLow = master->GetGUID().GetCounter();
+
+        if (name == "all")
+        {
+            std::vector<BotInfo>* bots = sBotMgr.GetBots(masterLow);
+            if (!bots || bots->empty())
+            {
+                handler->PSendSysMessage("|cffff0000You have no bots.|r");
+                return true;
+            }
+
+            uint32 geared = 0, items = 0;
+            for (BotInfo& info : *bots)
+            {
+                if (!info.player)
+                    continue;
+                if (uint32 count = DoAutoEquip(info, nullptr))
+                {
+                    sBotSaveScheduler.MarkDirty(info.player);
+                    ++geared;
+                    items += count;
+                }
+            }
+
+            uint32 saved = sBotSaveScheduler.FlushArmy(masterLow);
+            handler->PSendSysMessage("|cff00ff00Equipped {} item(s) on {} of {} bots, {} saved.|r",
+                items, geared, uint32(bots->size()), saved);
+            return true;
+        }
+
+        BotInfo* info = sBotMgr.FindBot(masterLow, name);
         if (!info || !info->player)
         {
             handler->PSendSysMessage("|cffff0000No bot named '{}' found.|r", name);
@@ -226,12 +512,12 @@ public:
         Player* bot = info->player;
         handler->PSendSysMessage("|cff00ff00Auto-equipping gear for {}...|r", name);
 
-        uint32 count = DoAutoEquip(bot, handler);
+        uint32 count = DoAutoEquip(*info, handler);
         if (count == 0)
             handler->PSendSysMessage("No upgrades found in bags.");
         else
         {
-            bot->SaveToDB(false, true);
+            sBotSaveScheduler.MarkDirty(bot);
             handler->PSendSysMessage("|cff00ff00Equipped {} item(s).|r", count);
         }
         return true;
@@ -251,6 +537,7 @@ public:
         }
 
         Player* bot = info->player;
+        ItemScoreProfile profile = sBotItemScore.GetProfile(bot, info->specIndex, info->role);
         handler->PSendSysMessage("|cff00ff00=== Gear for {} ===|r", bot->GetName());
 
         for (uint8 slot = EQUIPMENT_SLOT_START; slot < EQUIPMENT_SLOT_END; ++slot)
@@ -259,17 +546,106 @@ public:
             if (item && item->GetTemplate())
             {
                 auto* proto = item->GetTemplate();
-                handler->PSendSysMessage("  {}: {} (iLvl {})",
-                                         SlotName(slot), proto->Name1, proto->ItemLevel);
+                handler->PSendSysMessage("  {}: {} (iLvl {}, score {:.1f})",
+                                         SlotName(slot), proto->Name1, proto->ItemLevel,
+                                         sBotItemScore.Score(profile, proto));
             }
             else
                 handler->PSendSysMessage("  {}: (empty)", SlotName(slot));
         }
         return true;
     }
+
+    // ─── .army equipbench <name> [count] ───────────────────────────────────
+    // Runs the planner up to `count` times on the bot's current bags without
+    // swapping anything.  Fill a bot's bags to measure the worst case.  Runs
+    // on the world thread, so it stops at EQUIP_BENCH_MAX_RUNS runs or
+    // EQUIP_BENCH_BUDGET_US, whichever comes first, and never stalls a tick.
+    static constexpr uint32 EQUIP_BENCH_MAX_RUNS  = 200;
+    static constexpr uint64 EQUIP_BENCH_BUDGET_US = 5000;
+
+    static bool HandleEquipBenchCmd(ChatHandler* handler, std::string name, Optional<uint32> countArg)
+    {
+        Player* master = handler->GetSession()->GetPlayer();
+        if (!master) return false;
+
+        BotInfo* info = sBotMgr.FindBot(master->GetGUID().GetCounter(), name);
+        if (!info || !info->player)
+        {
+            handler->PSendSysMessage("|cffff0000No bot named '{}' found.|r", name);
+            return true;
+        }
+
+        uint32 count = std::clamp<uint32>(countArg.value_or(100), 1, EQUIP_BENCH_MAX_RUNS);
+
+        EquipPlan plan;
+        uint32 runs = 0;
+        uint64 startUs = BotPerfNowUs();
+        uint64 elapsedUs = 0;
+        while (runs < count && elapsedUs < EQUIP_BENCH_BUDGET_US)
+        {
+            PlanAutoEquip(*info, plan);
+            ++runs;
+            elapsedUs = BotPerfNowUs() - startUs;
+        }
+
+        handler->PSendSysMessage("|cff00ff00Auto-equip plan for {}: {} usable bag items, {} swaps planned.|r",
+            name, plan.candidates, uint32(plan.moves.size()));
+        handler->PSendSysMessage("  {} runs in {} us ({:.2f} us per plan){}",
+            runs, elapsedUs, double(elapsedUs) / runs,
+            runs < count ? " — stopped at the time budget" : "");
+        handler->PSendSysMessage("  Score cache: {} entries, {} hits / {} misses",
+            sBotItemScore.GetCacheSize(), sBotItemScore.GetHits(), sBotItemScore.GetMisses());
+        return true;
+    }
+};
+
+// ─── Player Script: queue items as bots receive them ───────────────────────────
+// Loot, group roll wins, master loot (stored through StoreNewItem) and quest
+// rewards.  Trades have no item hook in the core and are not covered.
+class BotEquipPlayerScript : public PlayerScript
+{
+public:
+    BotEquipPlayerScript() : PlayerScript("BotEquipPlayerScript",
+        {PLAYERHOOK_ON_LOOT_ITEM, PLAYERHOOK_ON_STORE_NEW_ITEM,
+         PLAYERHOOK_ON_QUEST_REWARD_ITEM, PLAYERHOOK_ON_GROUP_ROLL_REWARD_ITEM}) {}
+
+    void OnPlayerLootItem(Player* player, Item* item, uint32 /*count*/, ObjectGuid /*lootguid*/) override
+    {
+        QueueAcquired(player, item);
+    }
+
+    void OnPlayerStoreNewItem(Player* player, Item* item, uint32 /*count*/) override
+    {
+        QueueAcquired(player, item);
+    }
+
+    void OnPlayerQuestRewardItem(Player* player, Item* item, uint32 /*count*/) override
+    {
+        QueueAcquired(player, item);
+    }
+
+    void OnPlayerGroupRollRewardItem(Player* player, Item* item, uint32 /*count*/, RollVote /*voteType*/, Roll* /*roll*/) override
+    {
+        QueueAcquired(player, item);
+    }
+};
+
+// ─── World Script: equip queued items on the next tick ─────────────────────────
+class BotEquipWorldScript : public WorldScript
+{
+public:
+    BotEquipWorldScript() : WorldScript("BotEquipWorldScript") {}
+
+    void OnUpdate(uint32 /*diff*/) override
+    {
+        ProcessAcquired();
+    }
 };
 
 void AddBotEquipSystem()
 {
     new BotEquipCommands();
+    new BotEquipPlayerScript();
+    new BotEquipWorldScript();
 }
@@ -0,0 +1,135 @@
+// BotHibernation.cpp
+// Idle detection and suspend/resume for sleeping armies.  See BotHibernation.h.
+
+#include "BotHibernation.h"
+#include "BotAI.h"
+#include "MotionMaster.h"
+#include "Player.h"
+#include "RPGBotsConfig.h"
+#include "Timer.h"
+#include <cmath>
+
+static constexpr float HIBERNATE_MOVE_EPSILON = 1.0f;   // yards the master may drift while idle
+
+bool BotHibernation::Update(Player* master, std::vector<BotInfo>& bots)
+{
+    ObjectGuid::LowType masterLow = master->GetGUID().GetCounter();
+    uint32 now = getMSTime();
+
+    auto [it, inserted] = _masters.try_emplace(masterLow);
+    MasterIdleState& state = it->second;
+    if (inserted)
+    {
+        MasterActed(master, state);   // seed the position sample
+        state.lastActiveMs = now;
+    }
+
+    bool active = !RPGBotsConfig::HibernateEnabled || MasterActed(master, state);
+    for (BotInfo const& info : bots)
+        if (info.player && info.player->IsInCombat())
+            active = true;
+
+    if (active)
+    {
+        state.lastActiveMs = now;
+        if (state.asleep)
+        {
+            state.asleep = false;
+            ++_wakeups;
+            for (BotInfo& info : bots)
+                Resume(info);
+        }
+        return false;
+    }
+
+    if (!state.asleep)
+    {
+        if (!ShouldSleep(master, state, now))
+            return false;
+        state.asleep = true;
+        ++_sleeps;
+    }
+
+    // Also catches bots spawned into an army that is already asleep
+    for (BotInfo& info : bots)
+        Suspend(info);
+    return true;
+}
+
+bool BotHibernation::IsAsleep(ObjectGuid::LowType masterLow) const
+{
+    auto it = _masters.find(masterLow);
+    return it != _masters.end() && it->second.asleep;
+}
+
+uint32 BotHibernation::GetSleepingArmies() const
+{
+    uint32 count = 0;
+    for (auto const& [masterLow, state] : _masters)
+        if (state.asleep)
+            ++count;
+    return count;
+}
+
+// Moved, changed map, fighting or casting since the last sample
+bool BotHibernation::MasterActed(Player* master, MasterIdleState& state)
+{
+    bool moved = master->GetMapId() != state.mapId
+        || std::fabs(master->GetPositionX() - state.x) > HIBERNATE_MOVE_EPSILON
+        || std::fabs(master->GetPositionY() - state.y) > HIBERNATE_MOVE_EPSILON
+        || std::fabs(master->GetPositionZ() - state.z) > HIBERNATE_MOVE_EPSILON;
+
+    if (moved)
+    {
+        state.mapId = master->GetMapId();
+        state.x     = master->GetPositionX();
+        state.y     = master->GetPositionY();
+        state.z     = master->GetPositionZ();
+    }
+
+    return moved || master->IsInCombat() || master->IsNonMeleeSpellCast(false);
+}
+
+bool BotHibernation::ShouldSleep(Player* master, MasterIdleState const& state, uint32 now)
+{
+    if (master->isAFK())
+        return true;
+
+    uint32 idleMs = getMSTimeDiff(state.lastActiveMs, now);
+
+    if (RPGBotsConfig::HibernateIdleMs && idleMs >= RPGBotsConfig::HibernateIdleMs)
+        return true;
+
+    bool restArea = master->HasPlayerFlag(PLAYER_FLAGS_RESTING) || master->IsInSanctuary();
+    return restArea && RPGBotsConfig::HibernateRestIdleMs && idleMs >= RPGBotsConfig::HibernateRestIdleMs;
+}
+
+void BotHibernation::Suspend(BotInfo& info)
+{
+    Player* bot = info.player;
+    if (info.hibernating || !bot || !bot->IsInWorld())
+        return;
+
+    info.hibernating = true;
+    info.isFollowing = false;
+    info.queuedSpellId = 0;
+
+    bot->StopMoving();
+    bot->GetMotionMaster()->Clear();
+    bot->GetMotionMaster()->MoveIdle();
+
+    if (RPGBotsConfig::HibernateHide)
+        bot->SetVisible(false);
+}
+
+void BotHibernation::Resume(BotInfo& info)
+{
+    if (!info.hibernating)
+        return;
+
+    info.hibernating = false;
+
+    // Formation / follow logic re-places the bot on this same tick
+    if (info.player && !info.player->IsVisible())
+        info.player->SetVisible(true);
+}
@@ -0,0 +1,67 @@
+// BotHibernation.h
+// Puts an army to sleep while its master is idle.
+//
+// An army hibernates when its master is flagged AFK, has not moved, fought
+// or cast for RPGBots.Hibernate.IdleTime, or has been idle for the shorter
+// RPGBots.Hibernate.RestIdleTime in a rested or sanctuary area.  A sleeping
+// bot has its motion cleared and is pinned where it stands; the AI tick
+// skips the army entirely (no waterfall, no formation, no follow checks).
+// With RPGBots.Hibernate.Hide the bots are also made invisible, so nearby
+// players stop receiving updates for them.
+//
+// Activity is sampled on the AI tick.  The first tick that sees the master
+// move, fight or cast — or any bot pulled into combat — wakes the army and
+// runs its AI in that same tick.  World thread only.
+
+#pragma once
+
+#include "ObjectGuid.h"
+#include <unordered_map>
+#include <vector>
+
+class Player;
+struct BotInfo;
+
+class BotHibernation
+{
+public:
+    static BotHibernation& Instance()
+    {
+        static BotHibernation instance;
+        return instance;
+    }
+
+    // Called once per army per AI tick.  Returns true while the army sleeps;
+    // the caller then skips its AI and formation.
+    bool Update(Player* master, std::vector<BotInfo>& bots);
+
+    // Army dismissed: drop the master's idle state
+    void Forget(ObjectGuid::LowType masterLow) { _masters.erase(masterLow); }
+
+    bool   IsAsleep(ObjectGuid::LowType masterLow) const;
+    uint32 GetSleepingArmies() const;
+    uint64 GetSleeps()  const { return _sleeps; }
+    uint64 GetWakeups() const { return _wakeups; }
+
+private:
+    BotHibernation() = default;
+
+    struct MasterIdleState
+    {
+        uint32 mapId        = 0;
+        float  x = 0.0f, y = 0.0f, z = 0.0f;
+        uint32 lastActiveMs = 0;
+        bool   asleep       = false;
+    };
+
+    static bool MasterActed(Player* master, MasterIdleState& state);
+    static bool ShouldSleep(Player* master, MasterIdleState const& state, uint32 now);
+    static void Suspend(BotInfo& info);
+    static void Resume(BotInfo& info);
+
+    std::unordered_map<ObjectGuid::LowType, MasterIdleState> _masters;
+    uint64 _sleeps  = 0;
+    uint64 _wakeups = 0;
+};
+
+#define sBotHibernation BotHibernation::Instance()
@@ -0,0 +1,223 @@
+// BotItemScore.cpp
+// Stat weights, item scoring and the shared score cache.  See BotItemScore.h.
+
+#include "BotItemScore.h"
+#include "ItemTemplate.h"
+#include "Log.h"
+#include "Player.h"
+#include "RotationEngine.h"
+#include "RPGBotsDatabase.h"
+#include "ScriptMgr.h"
+#include <initializer_list>
+#include <utility>
+
+namespace
+{
+    static constexpr float ARMOR_TYPE_PENALTY  = 0.5f;    // below the class's best armor
+    static constexpr float WEAPON_TYPE_PENALTY = 0.5f;    // outside the spec's weapon mask
+    static constexpr float ILVL_TIEBREAK       = 0.01f;   // orders items with no weighted stats
+
+    StatWeights MakeWeights(std::initializer_list<std::pair<StatWeightIndex, float>> list)
+    {
+        StatWeights w;
+        for (auto const& [index, value] : list)
+            w.weight[index] = value;
+        return w;
+    }
+
+    // ─── Role defaults (specs without a bot_stat_weights row) ──────────────
+    StatWeights const& RoleDefaults(BotRole role)
+    {
+        static StatWeights const tank = MakeWeights({
+            { WEIGHT_STAMINA, 1.0f }, { WEIGHT_STRENGTH, 0.5f }, { WEIGHT_AGILITY, 0.4f },
+            { WEIGHT_DEFENSE, 1.0f }, { WEIGHT_DODGE, 0.8f }, { WEIGHT_PARRY, 0.7f },
+            { WEIGHT_BLOCK, 0.5f }, { WEIGHT_BLOCK_VALUE, 0.3f }, { WEIGHT_ARMOR, 0.05f },
+            { WEIGHT_EXPERTISE, 0.6f }, { WEIGHT_HIT, 0.4f }, { WEIGHT_MELEE_DPS, 1.0f },
+            { WEIGHT_SOCKET, 8.0f } });
+        static StatWeights const healer = MakeWeights({
+            { WEIGHT_INTELLECT, 1.0f }, { WEIGHT_SPELL_POWER, 0.9f }, { WEIGHT_SPIRIT, 0.6f },
+            { WEIGHT_MP5, 0.8f }, { WEIGHT_HASTE, 0.7f }, { WEIGHT_CRIT, 0.5f },
+            { WEIGHT_STAMINA, 0.1f }, { WEIGHT_SOCKET, 8.0f } });
+        static StatWeights const melee = MakeWeights({
+            { WEIGHT_STRENGTH, 1.0f }, { WEIGHT_AGILITY, 0.8f }, { WEIGHT_ATTACK_POWER, 0.5f },
+            { WEIGHT_HIT, 0.9f }, { WEIGHT_CRIT, 0.8f }, { WEIGHT_HASTE, 0.6f },
+            { WEIGHT_EXPERTISE, 0.8f }, { WEIGHT_ARMOR_PEN, 0.7f }, { WEIGHT_STAMINA, 0.1f },
+            { WEIGHT_MELEE_DPS, 3.0f }, { WEIGHT_SOCKET, 8.0f } });
+        static StatWeights const ranged = MakeWeights({
+            { WEIGHT_SPELL_POWER, 1.0f }, { WEIGHT_HIT, 1.0f }, { WEIGHT_HASTE, 0.8f },
+            { WEIGHT_CRIT, 0.7f }, { WEIGHT_INTELLECT, 0.6f }, { WEIGHT_SPIRIT, 0.2f },
+            { WEIGHT_STAMINA, 0.1f }, { WEIGHT_SOCKET, 8.0f } });
+
+        switch (role)
+        {
+            case BotRole::ROLE_TANK:       return tank;
+            case BotRole::ROLE_HEALER:     return healer;
+            case BotRole::ROLE_RANGED_DPS: return ranged;
+            default:                       return melee;
+        }
+    }
+
+    // ItemModType → weight slot (-1 = not weighted)
+    int8 WeightForStat(uint32 statType)
+    {
+        switch (statType)
+        {
+            case ITEM_MOD_STRENGTH:                 return WEIGHT_STRENGTH;
+            case ITEM_MOD_AGILITY:                  return WEIGHT_AGILITY;
+            case ITEM_MOD_STAMINA:                  return WEIGHT_STAMINA;
+            case ITEM_MOD_INTELLECT:                return WEIGHT_INTELLECT;
+            case ITEM_MOD_SPIRIT:                   return WEIGHT_SPIRIT;
+            case ITEM_MOD_ATTACK_POWER:
+            case ITEM_MOD_RANGED_ATTACK_POWER:      return WEIGHT_ATTACK_POWER;
+            case ITEM_MOD_SPELL_POWER:
+            case ITEM_MOD_SPELL_HEALING_DONE:
+            case ITEM_MOD_SPELL_DAMAGE_DONE:        return WEIGHT_SPELL_POWER;
+            case ITEM_MOD_HIT_MELEE_RATING:
+            case ITEM_MOD_HIT_RANGED_RATING:
+            case ITEM_MOD_HIT_SPELL_RATING:
+            case ITEM_MOD_HIT_RATING:               return WEIGHT_HIT;
+            case ITEM_MOD_CRIT_MELEE_RATING:
+            case ITEM_MOD_CRIT_RANGED_RATING:
+            case ITEM_MOD_CRIT_SPELL_RATING:
+            case ITEM_MOD_CRIT_RATING:              return WEIGHT_CRIT;
+            case ITEM_MOD_HASTE_MELEE_RATING:
+            case ITEM_MOD_HASTE_RANGED_RATING:
+            case ITEM_MOD_HASTE_SPELL_RATING:
+            case ITEM_MOD_HASTE_RATING:             return WEIGHT_HASTE;
+            case ITEM_MOD_EXPERTISE_RATING:         return WEIGHT_EXPERTISE;
+            case ITEM_MOD_ARMOR_PENETRATION_RATING: return WEIGHT_ARMOR_PEN;
+            case ITEM_MOD_DEFENSE_SKILL_RATING:     return WEIGHT_DEFENSE;
+            case ITEM_MOD_DODGE_RATING:             return WEIGHT_DODGE;
+            case ITEM_MOD_PARRY_RATING:             return WEIGHT_PARRY;
+            case ITEM_MOD_BLOCK_RATING:             return WEIGHT_BLOCK;
+            case ITEM_MOD_BLOCK_VALUE:              return WEIGHT_BLOCK_VALUE;
+            case ITEM_MOD_MANA_REGENERATION:        return WEIGHT_MP5;
+            default:                                return -1;
+        }
+    }
+
+    // Heaviest armor type the class is expected to wear at this level
+    uint8 BestArmorSubclass(uint8 classId, uint8 level)
+    {
+        switch (classId)
+        {
+            case CLASS_WARRIOR:
+            case CLASS_PALADIN:      return level >= 40 ? ITEM_SUBCLASS_ARMOR_PLATE : ITEM_SUBCLASS_ARMOR_MAIL;
+            case CLASS_DEATH_KNIGHT: return ITEM_SUBCLASS_ARMOR_PLATE;
+            case CLASS_HUNTER:
+            case CLASS_SHAMAN:       return level >= 40 ? ITEM_SUBCLASS_ARMOR_MAIL : ITEM_SUBCLASS_ARMOR_LEATHER;
+            case CLASS_ROGUE:
+            case CLASS_DRUID:        return ITEM_SUBCLASS_ARMOR_LEATHER;
+            default:                 return ITEM_SUBCLASS_ARMOR_CLOTH;
+        }
+    }
+
+    bool IsRangedWeapon(ItemTemplate const* proto)
+    {
+        return proto->InventoryType == INVTYPE_RANGED
+            || proto->InventoryType == INVTYPE_RANGEDRIGHT
+            || proto->InventoryType == INVTYPE_THROWN;
+    }
+}
+
+uint32 BotItemScore::LoadWeights()
+{
+    _weights.clear();
+    _cache.clear();
+
+    //  Column order matches StatWeightIndex
+    if (PreparedQueryResult result = RPGBotsDatabase.Query(RPGBotsDatabase.GetPreparedStatement(RPGBOTS_SEL_BOT_STAT_WEIGHTS)))
+    {
+        do {
+            Field* f = result->Fetch();
+            StatWeights& w = _weights[MakeSpecKey(f[0].Get<uint8>(), f[1].Get<uint8>())];
+            for (uint8 i = 0; i < MAX_STAT_WEIGHTS; ++i)
+                w.weight[i] = f[2 + i].Get<float>();
+            w.weaponMask = f[2 + MAX_STAT_WEIGHTS].Get<uint32>();
+        } while (result->NextRow());
+    }
+
+    LOG_INFO("module", "RPGBots: Loaded {} spec stat weight row(s)", _weights.size());
+    return uint32(_weights.size());
+}
+
+ItemScoreProfile BotItemScore::GetProfile(Player* bot, uint8 specIndex, BotRole role) const
+{
+    SpecKey spec = MakeSpecKey(bot->getClass(), specIndex);
+
+    ItemScoreProfile profile;
+    auto it = _weights.find(spec);
+    profile.weights       = it != _weights.end() ? &it->second : &RoleDefaults(role);
+    profile.armorSubclass = BestArmorSubclass(bot->getClass(), bot->GetLevel());
+    profile.key           = uint32(spec) | (uint32(role) << 16) | (uint32(profile.armorSubclass) << 24);
+    return profile;
+}
+
+float BotItemScore::Score(ItemScoreProfile const& profile, ItemTemplate const* proto)
+{
+    uint64 key = (uint64(profile.key) << 32) | proto->ItemId;
+    auto it = _cache.find(key);
+    if (it != _cache.end())
+    {
+        ++_hits;
+        return it->second;
+    }
+
+    ++_misses;
+    float score = Compute(profile, proto);
+    _cache.emplace(key, score);
+    return score;
+}
+
+float BotItemScore::Compute(ItemScoreProfile const& profile, ItemTemplate const* proto)
+{
+    float const* w = profile.weights->weight;
+    float score = 0.0f;
+
+    for (uint32 i = 0; i < proto->StatsCount && i < MAX_ITEM_PROTO_STATS; ++i)
+    {
+        int8 index = WeightForStat(proto->ItemStat[i].ItemStatType);
+        if (index >= 0)
+            score += w[index] * float(proto->ItemStat[i].ItemStatValue);
+    }
+
+    score += w[WEIGHT_ARMOR]       * float(proto->Armor);
+    score += w[WEIGHT_BLOCK_VALUE] * float(proto->Block);
+
+    for (uint8 s = 0; s < MAX_ITEM_PROTO_SOCKETS; ++s)
+        if (proto->Socket[s].Color)
+            score += w[WEIGHT_SOCKET];
+
+    if (proto->Class == ITEM_CLASS_WEAPON)
+    {
+        score += w[IsRangedWeapon(proto) ? WEIGHT_RANGED_DPS : WEIGHT_MELEE_DPS] * proto->getDPS();
+
+        uint32 mask = profile.weights->weaponMask;
+        if (mask && proto->SubClass < 32 && !(mask & (1u << proto->SubClass)))
+            score *= WEAPON_TYPE_PENALTY;
+    }
+    else if (proto->Class == ITEM_CLASS_ARMOR
+          && proto->SubClass >= ITEM_SUBCLASS_ARMOR_CLOTH && proto->SubClass <= ITEM_SUBCLASS_ARMOR_PLATE
+          && proto->InventoryType != INVTYPE_CLOAK
+          && proto->SubClass < profile.armorSubclass)
+        score *= ARMOR_TYPE_PENALTY;
+
+    return score + float(proto->ItemLevel) * ILVL_TIEBREAK;
+}
+
+// ─── World Script: load at startup ─────────────────────────────────────────────
+class BotItemScoreWorldScript : public WorldScript
+{
+public:
+    BotItemScoreWorldScript() : WorldScript("BotItemScoreWorldScript") {}
+
+    void OnStartup() override
+    {
+        sBotItemScore.LoadWeights();
+    }
+};
+
+void AddBotItemScore()
+{
+    new BotItemScoreWorldScript();
+}
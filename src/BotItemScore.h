@@ -0,0 +1,102 @@
+// BotItemScore.h
+// Spec-aware item scoring for bot auto-equip.
+//
+// Weights come from rpgbots.bot_stat_weights (one row per class/spec, like
+// bot_rotations), falling back to built-in defaults per role.  A score sums
+// weighted item stats, armor, weapon DPS and gem sockets, then penalises
+// armor below the class's best type and weapons outside the spec's list.
+//
+// A score depends only on the item and the scoring profile (spec, role and
+// armor tier), so scores are memoized realm-wide in one cache keyed by
+// (item entry, profile).  After warm-up, scoring a bag is one hash lookup
+// per item no matter how many bots share the spec.  World thread only.
+
+#pragma once
+
+#include "BotBehavior.h"
+#include "Define.h"
+#include <unordered_map>
+
+class Player;
+struct ItemTemplate;
+
+enum StatWeightIndex : uint8
+{
+    WEIGHT_STRENGTH,
+    WEIGHT_AGILITY,
+    WEIGHT_STAMINA,
+    WEIGHT_INTELLECT,
+    WEIGHT_SPIRIT,
+    WEIGHT_ATTACK_POWER,
+    WEIGHT_SPELL_POWER,
+    WEIGHT_HIT,
+    WEIGHT_CRIT,
+    WEIGHT_HASTE,
+    WEIGHT_EXPERTISE,
+    WEIGHT_ARMOR_PEN,
+    WEIGHT_DEFENSE,
+    WEIGHT_DODGE,
+    WEIGHT_PARRY,
+    WEIGHT_BLOCK,
+    WEIGHT_BLOCK_VALUE,
+    WEIGHT_MP5,
+    WEIGHT_ARMOR,
+    WEIGHT_MELEE_DPS,
+    WEIGHT_RANGED_DPS,
+    WEIGHT_SOCKET,
+    MAX_STAT_WEIGHTS
+};
+
+struct StatWeights
+{
+    float  weight[MAX_STAT_WEIGHTS] = {};
+    uint32 weaponMask = 0;   // 1 << ITEM_SUBCLASS_WEAPON_*, 0 = any
+};
+
+// Everything a score depends on besides the item, resolved once per bot
+struct ItemScoreProfile
+{
+    StatWeights const* weights = nullptr;
+    uint32 key          = 0;   // spec key | role | armor subclass
+    uint8  armorSubclass = 0;  // best armor type the bot can wear
+};
+
+class BotItemScore
+{
+public:
+    static BotItemScore& Instance()
+    {
+        static BotItemScore instance;
+        return instance;
+    }
+
+    // Load rpgbots.bot_stat_weights; also clears the score cache
+    uint32 LoadWeights();
+
+    // `specIndex` and `role` come from the bot's BotInfo (role overrides count)
+    ItemScoreProfile GetProfile(Player* bot, uint8 specIndex, BotRole role) const;
+
+    // Memoized per (item entry, profile)
+    float Score(ItemScoreProfile const& profile, ItemTemplate const* proto);
+
+    void   ClearCache()         { _cache.clear(); }
+    uint32 GetWeightCount() const { return uint32(_weights.size()); }
+    uint32 GetCacheSize()   const { return uint32(_cache.size()); }
+    uint64 GetHits()        const { return _hits; }
+    uint64 GetMisses()      const { return _misses; }
+
+private:
+    BotItemScore() = default;
+
+    static float Compute(ItemScoreProfile const& profile, ItemTemplate const* proto);
+
+    std::unordered_map<uint16, StatWeights> _weights;   // SpecKey → weights
+    std::unordered_map<uint64, float>       _cache;     // entry | profile key << 32
+    uint64 _hits   = 0;
+    uint64 _misses = 0;
+};
+
+#define sBotItemScore BotItemScore::Instance()
+
+// Registration
+void AddBotItemScore();
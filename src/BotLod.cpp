@@ -0,0 +1,219 @@
+// BotLod.cpp
+// AI level-of-detail tier assignment and per-tier stats.  See BotLod.h.
+
+#include "BotLod.h"
+#include "BotAI.h"
+#include "BotHibernation.h"
+#include "BotSpawnProcessor.h"
+#include "CellImpl.h"
+#include "Chat.h"
+#include "CommandScript.h"
+#include "GridNotifiers.h"
+#include "GridNotifiersImpl.h"
+#include "Player.h"
+#include "RPGBotsConfig.h"
+#include "ScriptMgr.h"
+#include "Timer.h"
+#include <list>
+
+static constexpr uint32 LOD_OBSERVER_REFRESH_MS = 5000;   // observer grid search per army
+static constexpr float  LOD_LOAD_EXIT_FRACTION  = 0.8f;   // load level clears below this share
+
+BotLodTierInfo const& BotLod::GetTierInfo(BotLodTier tier)
+{
+    static BotLodTierInfo const tiers[size_t(BotLodTier::MAX_LOD_TIERS)] =
+    {
+        { "full",    1, BUCKET_ALL },
+        { "reduced", 2, BUCKET_DEFENSIVES | BUCKET_HOTS | BUCKET_ABILITIES | BUCKET_MOBILITY },
+        { "follow",  3, 0 },
+        { "frozen",  0, 0 },
+    };
+    return tiers[uint8(tier) < uint8(BotLodTier::MAX_LOD_TIERS) ? uint8(tier) : 0];
+}
+
+bool BotLod::BeginTick(Player* master, std::vector<BotInfo> const& bots, BotLodTier& tier)
+{
+    UpdateLoad();
+
+    uint32 now = getMSTime();
+    ArmyLod& army = _armies[master->GetGUID().GetCounter()];
+    army.botCount = uint32(bots.size());
+
+    BotLodTier want = RPGBotsConfig::LodEnabled ? Desired(master, bots, army, now) : BotLodTier::LOD_FULL;
+
+    // Better tiers apply at once; worse ones must be wanted for the delay
+    bool change = want < army.tier;
+    if (want > army.tier)
+    {
+        if (!army.downgradePending)
+        {
+            army.downgradePending = true;
+            army.downgradeSinceMs = now;
+        }
+        change = getMSTimeDiff(army.downgradeSinceMs, now) >= RPGBotsConfig::LodDowngradeDelayMs;
+    }
+    else
+        army.downgradePending = false;
+
+    if (change)
+    {
+        army.tier = want;
+        army.tickCount = 0;
+        army.downgradePending = false;
+        ++_stats[uint8(want)].changes;
+    }
+
+    tier = army.tier;
+    uint8 every = GetTierInfo(tier).tickEvery;
+    return every && (army.tickCount++ % every) == 0;
+}
+
+void BotLod::Record(BotLodTier tier, uint32 bots, uint64 elapsedUs)
+{
+    TierStats& s = _stats[uint8(tier)];
+    ++s.updates;
+    s.botTicks += bots;
+    s.totalUs  += elapsedUs;
+}
+
+std::array<BotLod::TierStats, size_t(BotLodTier::MAX_LOD_TIERS)> BotLod::GetStats() const
+{
+    auto stats = _stats;
+    for (auto const& [masterLow, army] : _armies)
+    {
+        if (sBotHibernation.IsAsleep(masterLow))
+            continue;
+        ++stats[uint8(army.tier)].armies;
+        stats[uint8(army.tier)].bots += army.botCount;
+    }
+    return stats;
+}
+
+char const* BotLod::GetLoadName() const
+{
+    switch (_load)
+    {
+        case LoadLevel::HIGH:     return "high";
+        case LoadLevel::CRITICAL: return "critical";
+        default:                  return "normal";
+    }
+}
+
+void BotLod::ResetStats()
+{
+    for (TierStats& s : _stats)
+        s = {};
+}
+
+// Smoothed world diff (shared with spawn admission) against the thresholds;
+// an active level clears only below LOD_LOAD_EXIT_FRACTION of its threshold
+void BotLod::UpdateLoad()
+{
+    float avg = sBotSpawner.GetAvgDiffMs();
+    auto above = [avg](uint32 thresholdMs, bool active)
+    {
+        return thresholdMs && avg >= float(thresholdMs) * (active ? LOD_LOAD_EXIT_FRACTION : 1.0f);
+    };
+
+    if (above(RPGBotsConfig::LodLoadCriticalMs, _load == LoadLevel::CRITICAL))
+        _load = LoadLevel::CRITICAL;
+    else if (above(RPGBotsConfig::LodLoadHighMs, _load != LoadLevel::NORMAL))
+        _load = LoadLevel::HIGH;
+    else
+        _load = LoadLevel::NORMAL;
+}
+
+BotLodTier BotLod::Desired(Player* master, std::vector<BotInfo> const& bots, ArmyLod& army, uint32 now)
+{
+    if (!army.sampled || getMSTimeDiff(army.observedAtMs, now) >= LOD_OBSERVER_REFRESH_MS)
+    {
+        army.observers    = CountObservers(master);
+        army.observedAtMs = now;
+        army.sampled      = true;
+    }
+
+    bool combat = master->IsInCombat();
+    for (BotInfo const& info : bots)
+        if (info.isInCombat || (info.player && info.player->IsInCombat()))
+            combat = true;
+
+    bool observed = army.observers > 0;
+    if (combat)
+        return (_load != LoadLevel::NORMAL && !observed) ? BotLodTier::LOD_REDUCED : BotLodTier::LOD_FULL;
+    if (observed)
+        return BotLodTier::LOD_FULL;
+    return _load == LoadLevel::CRITICAL ? BotLodTier::LOD_FROZEN : BotLodTier::LOD_FOLLOW;
+}
+
+// Real players other than the master close enough to watch the army
+uint32 BotLod::CountObservers(Player* master)
+{
+    float range = RPGBotsConfig::LodObserverRange;
+    if (range <= 0.0f)
+        return 0;
+
+    std::list<Player*> players;
+    Acore::AnyPlayerInObjectRangeCheck check(master, range);
+    Acore::PlayerListSearcher<Acore::AnyPlayerInObjectRangeCheck> searcher(master, players, check);
+    Cell::VisitWorldObjects(master, searcher, range);
+
+    uint32 count = 0;
+    for (Player* player : players)
+        if (player != master && !sBotMgr.IsBot(player->GetGUID().GetCounter()))
+            ++count;
+    return count;
+}
+
+// ─── .army lod — tier population and CPU time ──────────────────────────────────
+class BotLodCommands : public CommandScript
+{
+public:
+    BotLodCommands() : CommandScript("BotLodCommands") {}
+
+    ChatCommandTable GetCommands() const override
+    {
+        static ChatCommandTable armyTable =
+        {
+            { "lod", HandleLodCmd, SEC_GAMEMASTER, Console::Yes },
+        };
+        static ChatCommandTable topTable =
+        {
+            { "army", armyTable },
+        };
+        return topTable;
+    }
+
+    // .army lod [reset]
+    static bool HandleLodCmd(ChatHandler* handler, Optional<std::string> arg)
+    {
+        if (arg && *arg == "reset")
+        {
+            sBotLod.ResetStats();
+            handler->PSendSysMessage("|cff00ff00[Army] LOD statistics reset.|r");
+            return true;
+        }
+
+        handler->PSendSysMessage("|cff00ff00=== Bot AI Level of Detail ===|r");
+        handler->PSendSysMessage("  Enabled: {}  Load: {} (world diff avg {:.1f} ms, high {} / critical {})",
+            RPGBotsConfig::LodEnabled ? "yes" : "no", sBotLod.GetLoadName(), sBotSpawner.GetAvgDiffMs(),
+            RPGBotsConfig::LodLoadHighMs, RPGBotsConfig::LodLoadCriticalMs);
+
+        auto stats = sBotLod.GetStats();
+        for (uint8 i = 0; i < uint8(BotLodTier::MAX_LOD_TIERS); ++i)
+        {
+            auto const& s = stats[i];
+            handler->PSendSysMessage("  {:<8} {:>4} armies {:>5} bots | {:>8} updates {:>10} us  avg {:>5} us/bot  entered {}",
+                BotLod::GetTierInfo(BotLodTier(i)).name, s.armies, s.bots, s.updates, s.totalUs,
+                s.botTicks ? s.totalUs / s.botTicks : 0, s.changes);
+        }
+
+        handler->PSendSysMessage("  Hibernating: {} armies ({} sleeps, {} wakeups)",
+            sBotHibernation.GetSleepingArmies(), sBotHibernation.GetSleeps(), sBotHibernation.GetWakeups());
+        return true;
+    }
+};
+
+void AddBotLod()
+{
+    new BotLodCommands();
+}
@@ -0,0 +1,128 @@
+// BotLod.h
+// AI level of detail: how often, and how much of, an army's AI runs.
+//
+//   Tier       Tick         Waterfall buckets
+//   full       every tick   all
+//   reduced    every 2nd    defensives, HoTs, abilities, mobility
+//   follow     every 3rd    none — follow / formation / teleport only
+//   frozen     never        none — bots keep their last movement
+//
+// Tiers are assigned per army on every AI tick from three inputs: combat
+// (master or any bot), observers (non-bot players other than the master
+// within RPGBots.Lod.ObserverRange, sampled every few seconds) and world
+// load (the smoothed world diff against RPGBots.Lod.LoadHigh/LoadCritical,
+// with a lower exit threshold so load does not flap).
+//
+//   combat            → full, or reduced under high load with no observers
+//   out of combat     → full when observed, follow otherwise,
+//                       frozen under critical load with no observers
+//
+// A better tier applies at once (the army runs on that same tick); a worse
+// one only after it has been wanted for RPGBots.Lod.DowngradeDelay.
+// Population and CPU time per tier are shown by `.army lod`.  World thread only.
+
+#pragma once
+
+#include "ObjectGuid.h"
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+class Player;
+struct BotInfo;
+
+enum class BotLodTier : uint8
+{
+    LOD_FULL    = 0,
+    LOD_REDUCED = 1,
+    LOD_FOLLOW  = 2,
+    LOD_FROZEN  = 3,
+    MAX_LOD_TIERS
+};
+
+// Waterfall buckets a tier may run (RunWaterfall bitmask)
+enum WaterfallBucket : uint8
+{
+    BUCKET_META       = 0x01,
+    BUCKET_BUFFS      = 0x02,
+    BUCKET_DEFENSIVES = 0x04,
+    BUCKET_DOTS       = 0x08,
+    BUCKET_HOTS       = 0x10,
+    BUCKET_ABILITIES  = 0x20,
+    BUCKET_MOBILITY   = 0x40,
+    BUCKET_ALL        = 0x7F
+};
+
+struct BotLodTierInfo
+{
+    char const* name;
+    uint8       tickEvery;   // AI ticks per update, 0 = never
+    uint8       buckets;     // WaterfallBucket mask
+};
+
+class BotLod
+{
+public:
+    static BotLod& Instance()
+    {
+        static BotLod instance;
+        return instance;
+    }
+
+    static BotLodTierInfo const& GetTierInfo(BotLodTier tier);
+
+    // Called once per army per AI tick.  Updates the army's tier and returns
+    // true if its AI runs this tick; `tier` receives the tier to run at.
+    bool BeginTick(Player* master, std::vector<BotInfo> const& bots, BotLodTier& tier);
+
+    // Time spent updating one army at `tier`
+    void Record(BotLodTier tier, uint32 bots, uint64 elapsedUs);
+
+    // Army dismissed
+    void Forget(ObjectGuid::LowType masterLow) { _armies.erase(masterLow); }
+
+    struct TierStats
+    {
+        uint32 armies  = 0;   // current population
+        uint32 bots    = 0;
+        uint64 updates = 0;   // army updates run
+        uint64 botTicks = 0;  // bot updates run
+        uint64 totalUs = 0;
+        uint64 changes = 0;   // armies that entered this tier
+    };
+
+    // Population is recounted on access
+    std::array<TierStats, size_t(BotLodTier::MAX_LOD_TIERS)> GetStats() const;
+    char const* GetLoadName() const;
+    void ResetStats();
+
+private:
+    BotLod() = default;
+
+    enum class LoadLevel : uint8 { NORMAL, HIGH, CRITICAL };
+
+    struct ArmyLod
+    {
+        BotLodTier tier           = BotLodTier::LOD_FULL;
+        uint32     tickCount      = 0;
+        uint32     botCount       = 0;
+        uint32     observers      = 0;
+        uint32     observedAtMs   = 0;
+        uint32     downgradeSinceMs = 0;   // when a worse tier was first wanted
+        bool       downgradePending = false;
+        bool       sampled        = false;   // observers counted at least once
+    };
+
+    void UpdateLoad();
+    BotLodTier Desired(Player* master, std::vector<BotInfo> const& bots, ArmyLod& army, uint32 now);
+    static uint32 CountObservers(Player* master);
+
+    std::unordered_map<ObjectGuid::LowType, ArmyLod> _armies;
+    std::array<TierStats, size_t(BotLodTier::MAX_LOD_TIERS)> _stats = {};
+    LoadLevel _load = LoadLevel::NORMAL;
+};
+
+#define sBotLod BotLod::Instance()
+
+// Registration
+void AddBotLod();
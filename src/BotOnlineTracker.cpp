@@ -0,0 +1,114 @@
+// BotOnlineTracker.cpp
+// Batched online-flag updates + crash reconciliation.  See BotOnlineTracker.h.
+
+#include "BotOnlineTracker.h"
+#include "ScriptMgr.h"
+#include "DatabaseEnv.h"
+#include "Log.h"
+#include <string>
+
+namespace
+{
+    void AppendGuid(std::string& list, ObjectGuid::LowType guid)
+    {
+        if (!list.empty())
+            list += ',';
+        list += std::to_string(guid);
+    }
+}
+
+void BotOnlineTracker::MarkOnline(ObjectGuid::LowType botLow, ObjectGuid::LowType masterLow)
+{
+    _pending[botLow] = { true, masterLow };
+}
+
+void BotOnlineTracker::MarkOffline(ObjectGuid::LowType botLow)
+{
+    _pending[botLow] = { false, 0 };
+}
+
+uint32 BotOnlineTracker::FlushInto(CharacterDatabaseTransaction trans)
+{
+    if (_pending.empty())
+        return 0;
+
+    std::string onlineList, offlineList, ledgerRows;
+    for (auto const& [botLow, t] : _pending)
+    {
+        if (t.online)
+        {
+            AppendGuid(onlineList, botLow);
+            if (!ledgerRows.empty())
+                ledgerRows += ',';
+            ledgerRows += "(" + std::to_string(botLow) + "," + std::to_string(t.masterLow) + ")";
+        }
+        else
+            AppendGuid(offlineList, botLow);
+    }
+
+    if (!onlineList.empty())
+    {
+        trans->Append("UPDATE characters SET online = 1 WHERE guid IN ({})", onlineList);
+        trans->Append("INSERT INTO rpgbots.bot_online (guid, master_guid) VALUES {} "
+                      "ON DUPLICATE KEY UPDATE master_guid = VALUES(master_guid)", ledgerRows);
+    }
+
+    if (!offlineList.empty())
+    {
+        trans->Append("UPDATE characters SET online = 0 WHERE guid IN ({})", offlineList);
+        trans->Append("DELETE FROM rpgbots.bot_online WHERE guid IN ({})", offlineList);
+    }
+
+    uint32 count = uint32(_pending.size());
+    _pending.clear();
+    return count;
+}
+
+void BotOnlineTracker::Flush()
+{
+    if (_pending.empty())
+        return;
+
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    FlushInto(trans);
+    CharacterDatabase.CommitTransaction(trans);
+}
+
+void BotOnlineTracker::ReconcileAtStartup()
+{
+    _pending.clear();
+
+    QueryResult result = CharacterDatabase.Query("SELECT COUNT(*) FROM rpgbots.bot_online");
+    uint32 stale = result ? (*result)[0].Get<uint32>() : 0;
+    if (!stale)
+        return;
+
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    trans->Append("UPDATE characters c JOIN rpgbots.bot_online b ON b.guid = c.guid SET c.online = 0");
+    trans->Append("DELETE FROM rpgbots.bot_online");
+    CharacterDatabase.DirectCommitTransaction(trans);
+
+    LOG_INFO("module", "RPGBots: Cleared stale online flag on {} bot character(s) from a previous run", stale);
+}
+
+// ─── World Script: reconcile at startup, flush once per tick ───────────────────
+class BotOnlineWorldScript : public WorldScript
+{
+public:
+    BotOnlineWorldScript() : WorldScript("BotOnlineWorldScript") {}
+
+    void OnStartup() override
+    {
+        sBotOnlineTracker.ReconcileAtStartup();
+    }
+
+    void OnUpdate(uint32 /*diff*/) override
+    {
+        sBotOnlineTracker.Flush();
+    }
+};
+
+void AddBotOnlineTracker()
+{
+    new BotOnlineWorldScript();
+}
@@ -0,0 +1,53 @@
+// BotOnlineTracker.h
+// Batches bot online/offline transitions into one statement per tick and
+// keeps a ledger (rpgbots.bot_online) of which characters are live bots, so
+// a crash never leaves alts flagged online.
+
+#pragma once
+
+#include "DatabaseEnvFwd.h"
+#include "ObjectGuid.h"
+#include <unordered_map>
+
+class BotOnlineTracker
+{
+public:
+    static BotOnlineTracker& Instance()
+    {
+        static BotOnlineTracker instance;
+        return instance;
+    }
+
+    // Queue a transition.  Within one tick the last transition for a bot wins.
+    void MarkOnline(ObjectGuid::LowType botLow, ObjectGuid::LowType masterLow);
+    void MarkOffline(ObjectGuid::LowType botLow);
+
+    bool HasPending() const { return !_pending.empty(); }
+
+    // Append all queued transitions to an existing transaction (used by
+    // dismiss, so the offline flag lands after the bot's final save).
+    // Returns the number of transitions written.
+    uint32 FlushInto(CharacterDatabaseTransaction trans);
+
+    // Commit queued transitions in their own async transaction (tick flush).
+    void Flush();
+
+    // Clear online flags left behind by a crash and empty the ledger.
+    void ReconcileAtStartup();
+
+private:
+    BotOnlineTracker() = default;
+
+    struct Transition
+    {
+        bool                online;
+        ObjectGuid::LowType masterLow;
+    };
+
+    std::unordered_map<ObjectGuid::LowType, Transition> _pending;
+};
+
+#define sBotOnlineTracker BotOnlineTracker::Instance()
+
+// Registration
+void AddBotOnlineTracker();
@@ -0,0 +1,302 @@
+// BotProfiler.cpp
+// Per-thread stage histograms, on-demand merge, `.army perf` and the
+// periodic log line.  See BotProfiler.h.
+
+#include "BotProfiler.h"
+#include "Chat.h"
+#include "CommandScript.h"
+#include "Log.h"
+#include "RPGBotsConfig.h"
+#include "ScriptMgr.h"
+#include "StringFormat.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    // Written only by its owning thread; readers merge with relaxed loads
+    struct ThreadBlock
+    {
+        std::atomic<uint32> epoch{ 0 };
+        std::array<std::array<std::atomic<uint64>, PERF_HISTOGRAM_BUCKETS>, MAX_PERF_STAGES> buckets{};
+        std::array<std::atomic<uint64>, MAX_PERF_STAGES> totalNs{};
+        std::array<std::atomic<uint64>, MAX_PERF_STAGES> maxNs{};
+    };
+
+    std::atomic<uint32> g_epoch{ 1 };
+    std::atomic<uint64> g_resetAtNs{ BotPerfNowNs() };
+
+    // Blocks are never freed: one outlives its thread so merges stay valid
+    std::mutex                g_blocksLock;
+    std::vector<ThreadBlock*> g_blocks;
+
+    ThreadBlock& LocalBlock()
+    {
+        thread_local ThreadBlock* block = nullptr;
+        if (!block)
+        {
+            block = new ThreadBlock();
+            std::lock_guard<std::mutex> guard(g_blocksLock);
+            g_blocks.push_back(block);
+        }
+        return *block;
+    }
+
+    // Single writer: a plain load + store, no locked read-modify-write
+    void Add(std::atomic<uint64>& counter, uint64 value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    // Exact below 16 ns, then 4 sub-buckets per power of two
+    uint8 BucketFor(uint64 ns)
+    {
+        if (ns < 16)
+            return uint8(ns);
+
+        uint32 log2 = 0;
+        for (uint64 t = ns; t >>= 1; )
+            ++log2;
+
+        uint32 bucket = 16 + (log2 - 4) * 4 + uint32((ns >> (log2 - 2)) & 3);
+        return uint8(std::min<uint32>(bucket, PERF_HISTOGRAM_BUCKETS - 1));
+    }
+
+    uint64 BucketUpperNs(uint32 bucket)
+    {
+        if (bucket < 16)
+            return bucket;
+        uint32 log2 = 4 + (bucket - 16) / 4;
+        uint32 sub  = (bucket - 16) % 4;
+        return (uint64(5 + sub) << (log2 - 2)) - 1;
+    }
+
+    std::string FormatNs(uint64 ns)
+    {
+        if (ns < 10000)
+            return Acore::StringFormat("{}ns", ns);
+        if (ns < 10000000)
+            return Acore::StringFormat("{:.1f}us", double(ns) / 1000.0);
+        return Acore::StringFormat("{:.1f}ms", double(ns) / 1000000.0);
+    }
+}
+
+char const* BotProfiler::StageName(BotPerfStage stage)
+{
+    switch (stage)
+    {
+        case PERF_UPDATE_BOT_AI:  return "UpdateBotAI";
+        case PERF_RUN_META:       return "RunMeta";
+        case PERF_RUN_BUFFS:      return "RunBuffs";
+        case PERF_RUN_DEFENSIVES: return "RunDefensives";
+        case PERF_RUN_DOTS:       return "RunDots";
+        case PERF_RUN_HOTS:       return "RunHots";
+        case PERF_RUN_ABILITIES:  return "RunAbilities";
+        case PERF_RUN_MOBILITY:   return "RunMobility";
+        case PERF_FORMATION:      return "Formation";
+        case PERF_SPAWN_COMPLETE: return "SpawnComplete";
+        case PERF_DISMISS_BOT:    return "DismissOneBot";
+        default:                  return "?";
+    }
+}
+
+void BotProfiler::Record(BotPerfStage stage, uint64 ns)
+{
+    ThreadBlock& block = LocalBlock();
+
+    // After a reset the owner clears its own block, so no reader ever writes it
+    uint32 epoch = g_epoch.load(std::memory_order_relaxed);
+    if (block.epoch.load(std::memory_order_relaxed) != epoch)
+    {
+        for (auto& stageBuckets : block.buckets)
+            for (auto& bucket : stageBuckets)
+                bucket.store(0, std::memory_order_relaxed);
+        for (uint8 i = 0; i < MAX_PERF_STAGES; ++i)
+        {
+            block.totalNs[i].store(0, std::memory_order_relaxed);
+            block.maxNs[i].store(0, std::memory_order_relaxed);
+        }
+        block.epoch.store(epoch, std::memory_order_relaxed);
+    }
+
+    Add(block.buckets[stage][BucketFor(ns)], 1);
+    Add(block.totalNs[stage], ns);
+    if (ns > block.maxNs[stage].load(std::memory_order_relaxed))
+        block.maxNs[stage].store(ns, std::memory_order_relaxed);
+}
+
+std::array<BotPerfStageStats, MAX_PERF_STAGES> BotProfiler::Collect()
+{
+    std::array<std::array<uint64, PERF_HISTOGRAM_BUCKETS>, MAX_PERF_STAGES> merged = {};
+    std::array<BotPerfStageStats, MAX_PERF_STAGES> stats = {};
+
+    uint32 epoch = g_epoch.load(std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> guard(g_blocksLock);
+        for (ThreadBlock const* block : g_blocks)
+        {
+            // A thread that has not recorded since the reset holds stale data
+            if (block->epoch.load(std::memory_order_relaxed) != epoch)
+                continue;
+
+            for (uint8 s = 0; s < MAX_PERF_STAGES; ++s)
+            {
+                for (uint32 b = 0; b < PERF_HISTOGRAM_BUCKETS; ++b)
+                    merged[s][b] += block->buckets[s][b].load(std::memory_order_relaxed);
+                stats[s].totalNs += block->totalNs[s].load(std::memory_order_relaxed);
+                stats[s].maxNs    = std::max(stats[s].maxNs, block->maxNs[s].load(std::memory_order_relaxed));
+            }
+        }
+    }
+
+    for (uint8 s = 0; s < MAX_PERF_STAGES; ++s)
+    {
+        BotPerfStageStats& st = stats[s];
+        for (uint64 count : merged[s])
+            st.calls += count;
+        if (!st.calls)
+            continue;
+
+        uint64 p50Rank = (st.calls + 1) / 2;
+        uint64 p99Rank = std::max<uint64>(1, (st.calls * 99 + 99) / 100);
+        uint64 seen = 0;
+        for (uint32 b = 0; b < PERF_HISTOGRAM_BUCKETS; ++b)
+        {
+            uint64 before = seen;
+            seen += merged[s][b];
+            if (before < p50Rank && seen >= p50Rank)
+                st.p50Ns = BucketUpperNs(b);
+            if (before < p99Rank && seen >= p99Rank)
+            {
+                st.p99Ns = BucketUpperNs(b);
+                break;
+            }
+        }
+
+        // A bucket bound may overshoot the largest sample
+        st.p50Ns = std::min(st.p50Ns, st.maxNs);
+        st.p99Ns = std::min(st.p99Ns, st.maxNs);
+    }
+    return stats;
+}
+
+float BotProfiler::GetWindowSeconds()
+{
+    return float(BotPerfNowNs() - g_resetAtNs.load(std::memory_order_relaxed)) / 1e9f;
+}
+
+void BotProfiler::Reset()
+{
+    g_resetAtNs.store(BotPerfNowNs(), std::memory_order_relaxed);
+    g_epoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::string BotProfiler::FormatSummary()
+{
+    auto stats = Collect();
+    float seconds = std::max(GetWindowSeconds(), 1.0f);
+
+    std::string line;
+    for (uint8 s = 0; s < MAX_PERF_STAGES; ++s)
+    {
+        BotPerfStageStats const& st = stats[s];
+        if (!st.calls)
+            continue;
+        if (!line.empty())
+            line += " | ";
+        line += Acore::StringFormat("{} {:.1f}/s p50 {} p99 {} max {}", StageName(BotPerfStage(s)),
+            float(st.calls) / seconds, FormatNs(st.p50Ns), FormatNs(st.p99Ns), FormatNs(st.maxNs));
+    }
+    return line;
+}
+
+// ─── World Script: periodic log line ───────────────────────────────────────────
+class BotProfilerWorldScript : public WorldScript
+{
+public:
+    BotProfilerWorldScript() : WorldScript("BotProfilerWorldScript") {}
+
+    void OnUpdate(uint32 diff) override
+    {
+#ifndef RPGBOTS_DISABLE_PROFILER
+        if (!RPGBotsConfig::ProfilerLogIntervalMs)
+            return;
+
+        _timer += diff;
+        if (_timer < RPGBotsConfig::ProfilerLogIntervalMs)
+            return;
+        _timer = 0;
+
+        std::string summary = BotProfiler::FormatSummary();
+        if (!summary.empty())
+            LOG_INFO("module", "RPGBots perf ({:.0f}s): {}", BotProfiler::GetWindowSeconds(), summary);
+#else
+        (void)diff;
+#endif
+    }
+
+private:
+    uint32 _timer = 0;
+};
+
+// ─── .army perf — stage timings ────────────────────────────────────────────────
+class BotProfilerCommands : public CommandScript
+{
+public:
+    BotProfilerCommands() : CommandScript("BotProfilerCommands") {}
+
+    ChatCommandTable GetCommands() const override
+    {
+        static ChatCommandTable armyTable =
+        {
+            { "perf", HandlePerfCmd, SEC_GAMEMASTER, Console::Yes },
+        };
+        static ChatCommandTable topTable =
+        {
+            { "army", armyTable },
+        };
+        return topTable;
+    }
+
+    // .army perf [reset]
+    static bool HandlePerfCmd(ChatHandler* handler, Optional<std::string> arg)
+    {
+#ifdef RPGBOTS_DISABLE_PROFILER
+        (void)arg;
+        handler->PSendSysMessage("|cffff0000[Army] Profiler compiled out (RPGBOTS_DISABLE_PROFILER).|r");
+        return true;
+#else
+        if (arg && *arg == "reset")
+        {
+            BotProfiler::Reset();
+            handler->PSendSysMessage("|cff00ff00[Army] Profiler reset.|r");
+            return true;
+        }
+
+        auto stats = BotProfiler::Collect();
+        float seconds = BotProfiler::GetWindowSeconds();
+
+        handler->PSendSysMessage("|cff00ff00=== Bot AI Profile ({:.0f}s since reset) ===|r", seconds);
+        handler->PSendSysMessage("  {:<14} {:>9} {:>8} {:>9} {:>9} {:>9} {:>9}",
+            "Stage", "Calls", "Calls/s", "Avg", "p50", "p99", "Max");
+        for (uint8 s = 0; s < MAX_PERF_STAGES; ++s)
+        {
+            BotPerfStageStats const& st = stats[s];
+            handler->PSendSysMessage("  {:<14} {:>9} {:>8.1f} {:>9} {:>9} {:>9} {:>9}",
+                BotProfiler::StageName(BotPerfStage(s)), st.calls,
+                seconds > 0.0f ? float(st.calls) / seconds : 0.0f,
+                FormatNs(st.calls ? st.totalNs / st.calls : 0), FormatNs(st.p50Ns),
+                FormatNs(st.p99Ns), FormatNs(st.maxNs));
+        }
+        return true;
+#endif
+    }
+};
+
+void AddBotProfiler()
+{
+    new BotProfilerWorldScript();
+    new BotProfilerCommands();
+}
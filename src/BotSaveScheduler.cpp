@@ -0,0 +1,207 @@
+// BotSaveScheduler.cpp
+// Coalesced, batched, async saves for bot alts.  See BotSaveScheduler.h.
+
+#include "BotSaveScheduler.h"
+#include "BotAI.h"
+#include "RPGBotsConfig.h"
+#include "ScriptMgr.h"
+#include "Player.h"
+#include "DatabaseEnv.h"
+#include "Log.h"
+
+void BotSaveScheduler::MarkDirty(Player* bot)
+{
+    if (!bot)
+        return;
+
+    if (!_dirty.insert(bot->GetGUID().GetCounter()).second)
+        ++_coalesced;
+}
+
+void BotSaveScheduler::MarkDirtyAsync(ObjectGuid::LowType guidLow)
+{
+    std::lock_guard<std::mutex> guard(_pendingLock);
+    _pending.push_back(guidLow);
+}
+
+void BotSaveScheduler::MergePending()
+{
+    {
+        std::lock_guard<std::mutex> guard(_pendingLock);
+        if (_pending.empty())
+            return;
+        _merging.swap(_pending);
+    }
+
+    // IsBot reads the registry, so it only runs here on the world thread
+    for (ObjectGuid::LowType guidLow : _merging)
+        if (sBotMgr.IsBot(guidLow) && !_dirty.insert(guidLow).second)
+            ++_coalesced;
+    _merging.clear();
+}
+
+void BotSaveScheduler::SaveInto(CharacterDatabaseTransaction trans, Player* bot)
+{
+    if (!bot)
+        return;
+
+    bot->SaveToDB(trans, false, false);
+    _dirty.erase(bot->GetGUID().GetCounter());
+    ++_botsWritten;
+}
+
+uint32 BotSaveScheduler::FlushArmy(ObjectGuid::LowType masterLow)
+{
+    if (_dirty.empty())
+        return 0;
+
+    auto* bots = sBotMgr.GetBots(masterLow);
+    if (!bots)
+        return 0;
+
+    CharacterDatabaseTransaction trans;
+    uint32 written = 0;
+
+    for (auto& info : *bots)
+    {
+        if (!info.player || !info.player->IsInWorld())
+            continue;
+        if (!IsDirty(info.player->GetGUID().GetCounter()))
+            continue;
+
+        if (!trans)
+            trans = CharacterDatabase.BeginTransaction();
+
+        SaveInto(trans, info.player);
+        ++written;
+    }
+
+    if (trans)
+    {
+        CharacterDatabase.CommitTransaction(trans);
+        ++_transactions;
+    }
+
+    return written;
+}
+
+uint32 BotSaveScheduler::FlushAll()
+{
+    if (_dirty.empty())
+        return 0;
+
+    uint32 written = 0;
+    for (auto& [masterLow, bots] : sBotMgr.GetAll())
+    {
+        (void)bots;
+        written += FlushArmy(masterLow);
+    }
+
+    // Drop flags of bots that are no longer registered; a registered bot
+    // skipped while out of the world keeps its flag for the next flush.
+    for (auto it = _dirty.begin(); it != _dirty.end(); )
+    {
+        if (sBotMgr.IsBot(*it))
+            ++it;
+        else
+            it = _dirty.erase(it);
+    }
+    return written;
+}
+
+void BotSaveScheduler::Update(uint32 diff)
+{
+    MergePending();
+
+    _timer += diff;
+    if (_timer < RPGBotsConfig::SaveIntervalMs)
+        return;
+    _timer = 0;
+
+    uint32 written = FlushAll();
+    if (written)
+        LOG_DEBUG("module", "RPGBots: Batched save wrote {} bot(s)", written);
+}
+
+void BotSaveScheduler::MarkLoadedStateClean(Player* bot)
+{
+    if (!bot)
+        return;
+
+    for (auto& [spellId, spell] : bot->GetSpellMap())
+    {
+        (void)spellId;
+        if (spell->State == PLAYERSPELL_NEW)
+            spell->State = PLAYERSPELL_UNCHANGED;
+    }
+
+    for (auto& [spellId, talent] : bot->GetTalentMap())
+    {
+        (void)spellId;
+        if (talent->State == PLAYERSPELL_NEW)
+            talent->State = PLAYERSPELL_UNCHANGED;
+    }
+}
+
+// ─── World Script: interval flush ──────────────────────────────────────────────
+class BotSaveWorldScript : public WorldScript
+{
+public:
+    BotSaveWorldScript() : WorldScript("BotSaveWorldScript") {}
+
+    void OnUpdate(uint32 diff) override
+    {
+        sBotSaveScheduler.Update(diff);
+    }
+};
+
+// ─── Player Script: flag bots whose progress changed ───────────────────────────
+// XP, loot, money and levels change outside any .army command, so bots pick
+// up a dirty flag here and are written with the next batch.  These hooks run
+// on map-update threads: the GUID is only queued, never checked here.
+class BotSavePlayerScript : public PlayerScript
+{
+public:
+    BotSavePlayerScript() : PlayerScript("BotSavePlayerScript",
+        {PLAYERHOOK_ON_GIVE_EXP, PLAYERHOOK_ON_LOOT_ITEM,
+         PLAYERHOOK_ON_MONEY_CHANGED, PLAYERHOOK_ON_LEVEL_CHANGED}) {}
+
+    void OnPlayerGiveXP(Player* player, uint32& /*amount*/, Unit* /*victim*/, uint8 /*xpSource*/) override
+    {
+        MarkIfBot(player);
+    }
+
+    void OnPlayerLootItem(Player* player, Item* /*item*/, uint32 /*count*/, ObjectGuid /*lootguid*/) override
+    {
+        MarkIfBot(player);
+    }
+
+    void OnPlayerMoneyChanged(Player* player, int32& /*amount*/) override
+    {
+        MarkIfBot(player);
+    }
+
+    void OnPlayerLevelChanged(Player* player, uint8 /*oldLevel*/) override
+    {
+        MarkIfBot(player);
+    }
+
+private:
+    // Real players almost never pass the filter, so the realm does not
+    // contend on the pending lock for their events
+    static void MarkIfBot(Player* player)
+    {
+        if (!player)
+            return;
+
+        ObjectGuid::LowType guidLow = player->GetGUID().GetCounter();
+        if (sBotMgr.MayBeBot(guidLow))
+            sBotSaveScheduler.MarkDirtyAsync(guidLow);
+    }
+};
+
+void AddBotSaveScheduler()
+{
+    new BotSaveWorldScript();
+    new BotSavePlayerScript();
+}
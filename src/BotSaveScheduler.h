@@ -0,0 +1,83 @@
+// BotSaveScheduler.h
+// Write-behind persistence for bot alts.
+//
+// Commands and hooks never call SaveToDB() directly on a bot.  They mark the
+// bot dirty instead; the scheduler coalesces every change made within one
+// interval and writes each army's dirty bots in ONE async transaction.
+// Dismissal appends the final save to the army's dismiss transaction.
+//
+// MarkDirty and everything else run on the world thread.  Progress hooks
+// (XP, loot, money, level) fire on map-update threads for every player on
+// the realm.  They drop real players with the lock-free BotManager::MayBeBot
+// filter, push the remaining GUIDs through MarkDirtyAsync, and the next world
+// tick keeps the confirmed bots and merges them into the dirty set.
+
+#pragma once
+
+#include "DatabaseEnvFwd.h"
+#include "ObjectGuid.h"
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+class Player;
+
+class BotSaveScheduler
+{
+public:
+    static BotSaveScheduler& Instance()
+    {
+        static BotSaveScheduler instance;
+        return instance;
+    }
+
+    // Flag a bot for the next batched save.  Repeated calls coalesce.  World thread.
+    void MarkDirty(Player* bot);
+
+    // Any thread: queue a possible bot; filtered and merged on the world thread
+    void MarkDirtyAsync(ObjectGuid::LowType guidLow);
+    bool IsDirty(ObjectGuid::LowType botLow) const { return _dirty.count(botLow) > 0; }
+
+    // Append a full save of this bot to an existing transaction and clear its flag.
+    void SaveInto(CharacterDatabaseTransaction trans, Player* bot);
+
+    // Commit every dirty bot of one army in a single async transaction.
+    // Returns the number of bots written.
+    uint32 FlushArmy(ObjectGuid::LowType masterLow);
+
+    // Flush all armies (interval tick).
+    uint32 FlushAll();
+
+    // Called from the world tick; merges async marks, flushes once per interval.
+    void Update(uint32 diff);
+
+    // Bots are loaded outside the core login flow, so every spell and talent
+    // read from the DB is left in PLAYERSPELL_NEW.  Reset those to UNCHANGED
+    // right after LoadFromDB() so a later save only emits real deltas instead
+    // of re-inserting rows that already exist.
+    static void MarkLoadedStateClean(Player* bot);
+
+    uint64 GetBotsWritten()         const { return _botsWritten; }
+    uint64 GetTransactionsWritten() const { return _transactions; }
+    uint64 GetMarksCoalesced()      const { return _coalesced; }
+
+private:
+    BotSaveScheduler() = default;
+
+    void MergePending();
+
+    std::unordered_set<ObjectGuid::LowType> _dirty;
+
+    std::mutex                       _pendingLock;
+    std::vector<ObjectGuid::LowType> _pending;   // from map threads, guarded by _pendingLock
+    std::vector<ObjectGuid::LowType> _merging;   // world thread, swapped with _pending
+    uint32 _timer        = 0;
+    uint64 _botsWritten  = 0;
+    uint64 _transactions = 0;
+    uint64 _coalesced    = 0;
+};
+
+#define sBotSaveScheduler BotSaveScheduler::Instance()
+
+// Registration
+void AddBotSaveScheduler();
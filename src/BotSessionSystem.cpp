@@ -1,19 +1,377 @@
 // BotSessionSystem.cpp
-// Implementation of bot session scaffolding for mod-rpgbots
+// Pooled, reusable socketless WorldSessions for bot alts.
 
 #include "BotSessionSystem.h"
-#include "Player.h"
+#include "RPGBotsConfig.h"
+#include "Chat.h"
+#include "CommandScript.h"
 #include "ScriptMgr.h"
+#include "WorldSession.h"
+#include "Player.h"
+#include "StringFormat.h"
+#include "Timer.h"
+#include "Log.h"
+
+using namespace Acore::ChatCommands;
+
+WorldSession* BotSessionPool::Create(uint32 accountId)
+{
+    // Uses the real account ID so LoadFromDB's account check passes.  The name
+    // is per account, not per bot, so it holds for every later lease.
+    WorldSession* session = new WorldSession(
+        accountId,                          // account id (must match character's account)
+        Acore::StringFormat("rpgbot-{}", accountId), // session name
+        0,                                  // account flags
+        nullptr,                            // no socket — this is a bot
+        SEC_PLAYER,                         // security
+        EXPANSION_WRATH_OF_THE_LICH_KING,   // expansion
+        0,                                  // mute time
+        LOCALE_enUS,                        // locale
+        0,                                  // recruiter
+        false,                              // isARecruiter
+        true,                               // skipQueue
+        0                                   // totalTime
+    );
+    // NOTE: We intentionally do NOT register this session with sWorldSessionMgr
+    // to avoid colliding with the master's real session (same account ID).
+    ++_created;
+    return session;
+}
+
+void BotSessionPool::Destroy(WorldSession* session)
+{
+    delete session;
+    ++_freed;
+}
+
+WorldSession* BotSessionPool::Acquire(uint32 accountId)
+{
+    WorldSession* session = nullptr;
+    BotSessionStats stats;
+
+    auto it = _idle.find(accountId);
+    if (it != _idle.end() && !it->second.empty())
+    {
+        session = it->second.back();
+        it->second.pop_back();
+        if (it->second.empty())
+            _idle.erase(it);
+
+        auto pit = _parked.find(session);
+        if (pit != _parked.end())
+        {
+            stats = pit->second;
+            _parked.erase(pit);
+        }
+        ++_reused;
+    }
+    else
+        session = Create(accountId);
+
+    stats.accountId      = accountId;
+    stats.leasedAtMs     = getMSTime();
+    stats.burstsSkipped   = 0;
+    stats.messagesSkipped = 0;
+    ++stats.timesLeased;
+    _active[session] = stats;
+    return session;
+}
+
+void BotSessionPool::Release(WorldSession* session)
+{
+    if (!session)
+        return;
+
+    auto it = _active.find(session);
+    if (it == _active.end())
+    {
+        // Not one of ours — never pool a foreign session
+        LOG_ERROR("module", "RPGBots: Released a session that was not leased from the pool");
+        return;
+    }
+
+    BotSessionStats stats = it->second;
+    _active.erase(it);
+
+    _doneSkippedBursts   += stats.burstsSkipped;
+    _doneSkippedMessages += stats.messagesSkipped;
+    _doneLeasedMs        += GetMSTimeDiffToNow(stats.leasedAtMs);
+
+    // Run whatever already completed while the session is still consistent,
+    // then detach the player.  Callbacks still in flight finish while the
+    // session drains, before any other bot can lease it.
+    session->GetQueryProcessor().ProcessReadyCallbacks();
+    session->SetPlayer(nullptr);
 
-BotSessionSystem::BotSessionSystem() : PlayerScript("BotSessionSystem") {}
+    _draining.push_back({ session, stats, getMSTime() });
+}
+
+void BotSessionPool::Park(WorldSession* session, BotSessionStats const& stats)
+{
+    if (GetIdleCount() >= RPGBotsConfig::SessionPoolMaxIdle)
+    {
+        Destroy(session);
+        return;
+    }
 
-void BotSessionSystem::ActivateAltSession(Player* altPlayer)
+    _idle[stats.accountId].push_back(session);
+    _parked[session] = stats;
+}
+
+void BotSessionPool::Prewarm(uint32 accountId, uint32 count)
 {
-    // TODO: Activate a world session for the alt character
-    // This should allow the alt to persist in the world without full bot logic
+    auto& idle = _idle[accountId];
+    while (idle.size() < count && GetIdleCount() < RPGBotsConfig::SessionPoolMaxIdle)
+    {
+        WorldSession* session = Create(accountId);
+        idle.push_back(session);
+        _parked[session] = { accountId, 0 };
+    }
+    if (idle.empty())
+        _idle.erase(accountId);
+}
+
+void BotSessionPool::Update()
+{
+    for (auto& [session, stats] : _active)
+    {
+        (void)stats;
+        session->GetQueryProcessor().ProcessReadyCallbacks();
+    }
+
+    if (_draining.empty())
+        return;
+
+    uint32 now = getMSTime();
+    for (auto it = _draining.begin(); it != _draining.end();)
+    {
+        it->session->GetQueryProcessor().ProcessReadyCallbacks();
+        if (getMSTimeDiff(it->releasedMs, now) < RPGBotsConfig::SessionDrainMs)
+        {
+            ++it;
+            continue;
+        }
+
+        Park(it->session, it->stats);
+        it = _draining.erase(it);
+    }
 }
 
+uint32 BotSessionPool::Trim(uint32 keepIdle)
+{
+    uint32 freed = 0;
+    for (auto it = _idle.begin(); it != _idle.end();)
+    {
+        auto& vec = it->second;
+        while (!vec.empty() && GetIdleCount() > keepIdle)
+        {
+            WorldSession* session = vec.back();
+            vec.pop_back();
+            _parked.erase(session);
+            Destroy(session);
+            ++freed;
+        }
+        if (vec.empty())
+            it = _idle.erase(it);
+        else
+            ++it;
+    }
+    return freed;
+}
+
+uint32 BotSessionPool::Shutdown()
+{
+    uint32 freed = 0;
+    for (DrainingSession const& draining : _draining)
+    {
+        draining.session->GetQueryProcessor().ProcessReadyCallbacks();
+        Destroy(draining.session);
+        ++freed;
+    }
+    _draining.clear();
+
+    // Only sessions of spawns still loading should be leased by now
+    for (auto& [session, stats] : _active)
+    {
+        _doneSkippedBursts   += stats.burstsSkipped;
+        _doneSkippedMessages += stats.messagesSkipped;
+        _doneLeasedMs        += GetMSTimeDiffToNow(stats.leasedAtMs);
+        session->GetQueryProcessor().ProcessReadyCallbacks();
+        session->SetPlayer(nullptr);
+        Destroy(session);
+        ++freed;
+    }
+    _active.clear();
+
+    return freed + Trim(0);
+}
+
+uint32 BotSessionPool::GetIdleCount() const
+{
+    return uint32(_parked.size());
+}
+
+size_t BotSessionPool::SessionObjectBytes()
+{
+    // The object and its pool entry (map node + stats) only; strings, maps and
+    // other heap members of WorldSession are not included.
+    return sizeof(WorldSession) + sizeof(BotSessionStats) + 4 * sizeof(void*);
+}
+
+BotSessionStats const* BotSessionPool::GetStats(WorldSession const* session) const
+{
+    auto it = _active.find(const_cast<WorldSession*>(session));
+    return it != _active.end() ? &it->second : nullptr;
+}
+
+void BotSessionPool::RecordSkippedBurst(WorldSession const* session)
+{
+    auto it = _active.find(const_cast<WorldSession*>(session));
+    if (it != _active.end())
+        ++it->second.burstsSkipped;
+}
+
+void BotSessionPool::RecordSkippedMessage(WorldSession const* session)
+{
+    auto it = _active.find(const_cast<WorldSession*>(session));
+    if (it != _active.end())
+        ++it->second.messagesSkipped;
+}
+
+uint64 BotSessionPool::GetSkippedBursts() const
+{
+    uint64 bursts = _doneSkippedBursts;
+    for (auto const& [session, stats] : _active)
+    {
+        (void)session;
+        bursts += stats.burstsSkipped;
+    }
+    return bursts;
+}
+
+uint64 BotSessionPool::GetSkippedMessages() const
+{
+    uint64 messages = _doneSkippedMessages;
+    for (auto const& [session, stats] : _active)
+    {
+        (void)session;
+        messages += stats.messagesSkipped;
+    }
+    return messages;
+}
+
+double BotSessionPool::GetLeasedMinutes() const
+{
+    uint64 leasedMs = _doneLeasedMs;
+    for (auto const& [session, stats] : _active)
+    {
+        (void)session;
+        leasedMs += GetMSTimeDiffToNow(stats.leasedAtMs);
+    }
+    return double(leasedMs) / double(MINUTE * IN_MILLISECONDS);
+}
+
+// ─── Bot-mode login ────────────────────────────────────────────────────────────
+void BotInitialPacketsBeforeAddToMap(Player* bot)
+{
+    if (!RPGBotsConfig::SuppressClientPackets)
+    {
+        bot->SendInitialPacketsBeforeAddToMap();
+        return;
+    }
+
+    // Server-side state normally set at the end of the burst
+    if (bot->IsFreeFlying() || bot->IsTaxiFlying())
+        bot->m_movementInfo.AddMovementFlag(MOVEMENTFLAG_FLYING);
+    bot->SetMover(bot);
+
+    sBotSessionPool.RecordSkippedBurst(bot->GetSession());
+}
+
+void BotInitialPacketsAfterAddToMap(Player* bot)
+{
+    if (!RPGBotsConfig::SuppressClientPackets)
+    {
+        bot->SendInitialPacketsAfterAddToMap();
+        return;
+    }
+
+    // Zone/area must still be resolved server-side (zone auras, rest, PvP state).
+    // Visibility was already refreshed by Map::AddPlayerToMap.
+    uint32 newZone, newArea;
+    bot->GetZoneAndAreaId(newZone, newArea);
+    bot->UpdateZone(newZone, newArea);
+
+    sBotSessionPool.RecordSkippedBurst(bot->GetSession());
+}
+
+// ─── World Script: drain bot session callbacks every tick ──────────────────────
+class BotSessionWorldScript : public WorldScript
+{
+public:
+    BotSessionWorldScript() : WorldScript("BotSessionWorldScript") {}
+
+    void OnUpdate(uint32 /*diff*/) override
+    {
+        sBotSessionPool.Update();
+    }
+};
+
+// ─── .army sessions — pool statistics ──────────────────────────────────────────
+class BotSessionCommands : public CommandScript
+{
+public:
+    BotSessionCommands() : CommandScript("BotSessionCommands") {}
+
+    ChatCommandTable GetCommands() const override
+    {
+        static ChatCommandTable armyTable =
+        {
+            { "sessions", HandleSessionsCmd, SEC_GAMEMASTER, Console::Yes },
+        };
+        static ChatCommandTable topTable =
+        {
+            { "army", armyTable },
+        };
+        return topTable;
+    }
+
+    // .army sessions [trim]
+    static bool HandleSessionsCmd(ChatHandler* handler, Optional<std::string> arg)
+    {
+        if (arg && *arg == "trim")
+        {
+            uint32 freed = sBotSessionPool.Trim(0);
+            handler->PSendSysMessage("|cff00ff00[Army] Freed {} idle bot session(s).|r", freed);
+            return true;
+        }
+
+        size_t perSession = BotSessionPool::SessionObjectBytes();
+        uint32 active   = sBotSessionPool.GetActiveCount();
+        uint32 idle     = sBotSessionPool.GetIdleCount();
+        uint32 draining = sBotSessionPool.GetDrainingCount();
+
+        handler->PSendSysMessage("|cff00ff00=== Bot Session Pool ===|r");
+        handler->PSendSysMessage("  Active: {}  Draining: {}  Idle: {} (cap {})",
+            active, draining, idle, RPGBotsConfig::SessionPoolMaxIdle);
+        handler->PSendSysMessage("  Created: {}  Reused: {}  Freed: {}",
+            sBotSessionPool.GetCreated(), sBotSessionPool.GetReused(), sBotSessionPool.GetFreed());
+        handler->PSendSysMessage("  sizeof(WorldSession) + pool entry: {} bytes/session, {} KB held "
+            "(heap members not counted)", perSession, (perSession * (active + draining + idle)) / 1024);
+        uint64 bursts     = sBotSessionPool.GetSkippedBursts();
+        uint64 messages   = sBotSessionPool.GetSkippedMessages();
+        double botMinutes = sBotSessionPool.GetLeasedMinutes();
+        handler->PSendSysMessage("  Client packets skipped: {} login bursts, {} module messages (suppression {})",
+            bursts, messages, RPGBotsConfig::SuppressClientPackets ? "ON" : "OFF");
+        handler->PSendSysMessage("  Per bot-minute ({:.1f} bot-minutes leased): {:.3f} bursts, {:.3f} messages",
+            botMinutes, botMinutes > 0.0 ? double(bursts) / botMinutes : 0.0,
+            botMinutes > 0.0 ? double(messages) / botMinutes : 0.0);
+        return true;
+    }
+};
+
 void AddBotSessionSystem()
 {
-    new BotSessionSystem();
+    new BotSessionWorldScript();
+    new BotSessionCommands();
 }
@@ -1,20 +1,153 @@
 // BotSessionSystem.h
-// Handles bot session scaffolding for mod-rpgbots
+// Pool of socketless WorldSessions for bot alts.
+//
+// Bot sessions are never registered with sWorldSessionMgr (that would collide
+// with the master's session on the same account), so nothing else owns,
+// updates or frees them.  The pool does:
+//   - hands out pre-built sessions per account and takes them back on dismiss,
+//     so spawn/dismiss churn stops allocating a WorldSession every time
+//   - drains each active session's query callbacks once per tick (the core
+//     never updates these sessions, so callbacks would otherwise pile up)
+//   - keeps per-session counters and the object size for `.army sessions`
+//
+// Reuse: every session of an account is built with the same neutral name
+// ("rpgbot-<account>"), never a character name, so a recycled session
+// carries nothing from its previous bot.  A released session is detached
+// from its player and kept draining for RPGBots.SessionPool.DrainTime — its
+// ready callbacks processed every tick — before it becomes idle.  The core
+// does not expose how many callbacks a session still has pending, so this is
+// a delay, not a guarantee: a query slower than the drain time completes into
+// the session's next lease.
+//
+// Packet buffers: outbound packets are dropped by WorldSession::SendPacket
+// before buffering because the socket is null, and nothing feeds the inbound
+// queue of a socketless session, so neither buffer can grow.
+//
+// Client-packet suppression (RPGBots.Bot.SuppressClientPackets): the login
+// bursts built by SendInitialPacketsBefore/AfterAddToMap only make sense for a
+// real client, so bots get the server-side state from those calls and skip the
+// packets.  Module code that would message a bot's own session checks
+// IsBotSession() first.  Each skipped burst and message is counted per
+// session for `.army sessions`; only counts are kept, no size estimates.
+// Leased time is summed too, so the counts are also reported per bot-minute
+// and stay comparable across army sizes and uptimes.
 
 #ifndef MODULE_RPG_BOTS_BOT_SESSION_SYSTEM_H
 #define MODULE_RPG_BOTS_BOT_SESSION_SYSTEM_H
 
-#include "ScriptMgr.h"
-#include "Player.h"
+#include "Define.h"
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
-class BotSessionSystem : public PlayerScript
+class Player;
+class WorldSession;
+
+// Per-session bookkeeping (lives as long as the pooled session)
+struct BotSessionStats
+{
+    uint32 accountId      = 0;
+    uint32 timesLeased    = 0;   // how many bots this session has hosted
+    uint32 leasedAtMs     = 0;   // getMSTime() when the current lease started
+    uint32 burstsSkipped   = 0;  // login bursts skipped during the current lease
+    uint32 messagesSkipped = 0;  // module chat packets never built during the current lease
+};
+
+class BotSessionPool
 {
 public:
-    BotSessionSystem();
+    static BotSessionPool& Instance()
+    {
+        static BotSessionPool instance;
+        return instance;
+    }
+
+    // Lease a session for the given account (reuses an idle one if possible)
+    WorldSession* Acquire(uint32 accountId);
+
+    // Return a session to the pool.  The player link must already be cleared
+    // or is cleared here.  The session drains before it is idle; sessions
+    // beyond the idle cap are then freed.
+    void Release(WorldSession* session);
+
+    // Build idle sessions ahead of a batch spawn
+    void Prewarm(uint32 accountId, uint32 count);
+
+    // True if the session is a leased bot session (O(1))
+    bool IsBotSession(WorldSession const* session) const
+    {
+        return session && _active.count(const_cast<WorldSession*>(session)) > 0;
+    }
+
+    // Drain query callbacks of active and released sessions; park drained ones
+    void Update();
+
+    // Free idle sessions down to keepIdle (.army sessions trim)
+    uint32 Trim(uint32 keepIdle);
+
+    // Run what is ready and free every session — active, draining and idle.
+    // Call after all armies are dismissed.  Returns the number freed.
+    uint32 Shutdown();
+
+    uint32 GetActiveCount()   const { return uint32(_active.size()); }
+    uint32 GetIdleCount()     const;
+    uint32 GetDrainingCount() const { return uint32(_draining.size()); }
+    uint64 GetCreated()     const { return _created; }
+    uint64 GetReused()      const { return _reused; }
+    uint64 GetFreed()       const { return _freed; }
 
-    // Called to activate a session for an alt character
-    void ActivateAltSession(Player* altPlayer);
-    // Add more hooks as needed for bot session management
+    // sizeof(WorldSession) plus the pool's own entry; heap members not counted
+    static size_t SessionObjectBytes();
+
+    BotSessionStats const* GetStats(WorldSession const* session) const;
+
+    // Record a skipped login burst / module message for a bot session
+    void RecordSkippedBurst(WorldSession const* session);
+    void RecordSkippedMessage(WorldSession const* session);
+
+    // Totals over all leases, finished and current
+    uint64 GetSkippedBursts() const;
+    uint64 GetSkippedMessages() const;
+
+    // Minutes of leased session time, finished and current leases
+    double GetLeasedMinutes() const;
+
+private:
+    BotSessionPool() = default;
+    WorldSession* Create(uint32 accountId);
+    void Destroy(WorldSession* session);
+    void Park(WorldSession* session, BotSessionStats const& stats);
+
+    struct DrainingSession
+    {
+        WorldSession*   session;
+        BotSessionStats stats;
+        uint32          releasedMs;
+    };
+
+    std::unordered_map<uint32, std::vector<WorldSession*>> _idle;   // accountId → idle sessions
+    std::unordered_map<WorldSession*, BotSessionStats>     _active; // leased sessions
+    std::unordered_map<WorldSession*, BotSessionStats>     _parked; // stats of idle sessions
+    std::vector<DrainingSession>                           _draining; // released, callbacks still draining
+
+    uint64 _created = 0;
+    uint64 _reused  = 0;
+    uint64 _freed   = 0;
+
+    // Totals of finished leases
+    uint64 _doneSkippedBursts   = 0;
+    uint64 _doneSkippedMessages = 0;
+    uint64 _doneLeasedMs        = 0;
 };
 
+#define sBotSessionPool BotSessionPool::Instance()
+
+// ─── Bot-mode login (client-only packet bursts skipped) ────────────────────────
+// Use in place of Player::SendInitialPacketsBeforeAddToMap /
+// SendInitialPacketsAfterAddToMap.  They apply the server-side state those
+// calls set, then send the real packets only if suppression is disabled.
+void BotInitialPacketsBeforeAddToMap(Player* bot);
+void BotInitialPacketsAfterAddToMap(Player* bot);
+
 #endif // MODULE_RPG_BOTS_BOT_SESSION_SYSTEM_H
@@ -0,0 +1,718 @@
+// BotSpawnProcessor.cpp
+// Module-owned spawn queue: login query holders, staged spawn, latency stats.
+// See BotSpawnProcessor.h.
+
+#include "BotSpawnProcessor.h"
+#include "ArmyRoster.h"
+#include "BotAI.h"
+#include "BotBehavior.h"
+#include "BotDecisionTrace.h"
+#include "BotOnlineTracker.h"
+#include "BotProfiler.h"
+#include "BotSaveScheduler.h"
+#include "BotSessionSystem.h"
+#include "PersonalitySystem.h"
+#include "RPGBotsConfig.h"
+#include "Chat.h"
+#include "CommandScript.h"
+#include "ScriptMgr.h"
+#include "Player.h"
+#include "ObjectAccessor.h"
+#include "WorldSession.h"
+#include "Group.h"
+#include "World.h"
+#include "DatabaseEnv.h"
+#include "Map.h"
+#include "MotionMaster.h"
+#include "GameTime.h"
+#include "Random.h"
+#include "Timer.h"
+#include "Common.h"
+#include "Log.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace Acore::ChatCommands;
+
+namespace
+{
+    static constexpr float  DIFF_EMA_ALPHA        = 1.0f / 16.0f;  // ~16-tick moving average
+    static constexpr float  LOAD_REOPEN_FRACTION  = 0.9f;          // hysteresis for the load gate
+    static constexpr uint32 QUEUE_NOTIFY_INTERVAL = 10 * IN_MILLISECONDS;
+}
+
+// ─── BotLoginQueryHolder ───────────────────────────────────────────────────────
+// Replicates the LoginQueryHolder from CharacterHandler.cpp (which is a local class)
+// so we can load a character's full data from outside the normal login flow.
+class BotLoginQueryHolder : public CharacterDatabaseQueryHolder
+{
+    uint32 m_accountId;
+    ObjectGuid m_guid;
+public:
+    BotLoginQueryHolder(uint32 accountId, ObjectGuid guid)
+        : m_accountId(accountId), m_guid(guid) {}
+
+    ObjectGuid GetGuid() const { return m_guid; }
+    uint32 GetAccountId() const { return m_accountId; }
+
+    bool Initialize()
+    {
+        SetSize(MAX_PLAYER_LOGIN_QUERY);
+        bool res = true;
+        ObjectGuid::LowType lowGuid = m_guid.GetCounter();
+
+        CharacterDatabasePreparedStatement* stmt = nullptr;
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_FROM, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_AURAS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_AURAS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_SPELL);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_SPELLS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_QUESTSTATUS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_QUEST_STATUS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_DAILYQUESTSTATUS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_DAILY_QUEST_STATUS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_WEEKLYQUESTSTATUS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_WEEKLY_QUEST_STATUS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_MONTHLYQUESTSTATUS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MONTHLY_QUEST_STATUS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_SEASONALQUESTSTATUS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_SEASONAL_QUEST_STATUS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_REPUTATION);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_REPUTATION, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_INVENTORY);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_INVENTORY, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_ACTIONS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_ACTIONS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAIL);
+        stmt->SetData(0, lowGuid);
+        stmt->SetData(1, uint32(GameTime::GetGameTime().count()));
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAILS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_SOCIALLIST);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_SOCIAL_LIST, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_HOMEBIND);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_HOME_BIND, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_SPELLCOOLDOWNS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_SPELL_COOLDOWNS, stmt);
+
+        if (sWorld->getBoolConfig(CONFIG_DECLINED_NAMES_USED))
+        {
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_DECLINEDNAMES);
+            stmt->SetData(0, lowGuid);
+            res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_DECLINED_NAMES, stmt);
+        }
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_ACHIEVEMENTS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_ACHIEVEMENTS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_CRITERIAPROGRESS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_CRITERIA_PROGRESS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_EQUIPMENTSETS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_EQUIPMENT_SETS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_ENTRY_POINT);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_ENTRY_POINT, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_GLYPHS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_GLYPHS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_TALENTS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_TALENTS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PLAYER_ACCOUNT_DATA);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_ACCOUNT_DATA, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_SKILLS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_SKILLS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_RANDOMBG);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_RANDOM_BG, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_BANNED);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_BANNED, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_QUESTSTATUSREW);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_QUEST_STATUS_REW, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_BREW_OF_THE_MONTH);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_BREW_OF_THE_MONTH, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_ACCOUNT_INSTANCELOCKTIMES);
+        stmt->SetData(0, m_accountId);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_INSTANCE_LOCK_TIMES, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CORPSE_LOCATION);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_CORPSE_LOCATION, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_SETTINGS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_CHARACTER_SETTINGS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_PETS);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_PET_SLOTS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES);
+        stmt->SetData(0, lowGuid);
+        res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_OFFLINE_ACHIEVEMENTS_UPDATES, stmt);
+
+        return res;
+    }
+};
+
+// ─── Queue ─────────────────────────────────────────────────────────────────────
+uint32 BotSpawnProcessor::Enqueue(Player* master, ObjectGuid botGuid, std::string const& botName)
+{
+    if (IsPending(botGuid))
+        return 0;
+
+    auto req = std::make_shared<BotSpawnRequest>();
+    req->id         = _nextId++;
+    req->masterGuid = master->GetGUID();
+    req->botGuid    = botGuid;
+    req->accountId  = master->GetSession()->GetAccountId();
+    req->botName    = botName;
+    req->queuedAtMs = getMSTime();
+    _queue.push_back(req);
+    return req->id;
+}
+
+uint32 BotSpawnProcessor::CancelForMaster(ObjectGuid::LowType masterLow)
+{
+    uint32 count = 0;
+
+    // Queued requests hold nothing yet — just drop them
+    for (auto it = _queue.begin(); it != _queue.end();)
+    {
+        if ((*it)->masterGuid.GetCounter() == masterLow)
+        {
+            Abandon(**it, SpawnStage::CANCELLED);
+            it = _queue.erase(it);
+            ++count;
+        }
+        else
+            ++it;
+    }
+
+    // In-flight holders can't be recalled; Complete() returns their session
+    for (auto& [id, req] : _inFlight)
+    {
+        (void)id;
+        if (req->masterGuid.GetCounter() == masterLow && req->stage == SpawnStage::LOADING)
+        {
+            req->stage = SpawnStage::CANCELLED;
+            ++count;
+        }
+    }
+    return count;
+}
+
+bool BotSpawnProcessor::IsPending(ObjectGuid botGuid) const
+{
+    for (auto const& req : _queue)
+        if (req->botGuid == botGuid)
+            return true;
+    for (auto const& [id, req] : _inFlight)
+    {
+        (void)id;
+        if (req->botGuid == botGuid && req->stage == SpawnStage::LOADING)
+            return true;
+    }
+    return false;
+}
+
+uint32 BotSpawnProcessor::GetPendingCount(ObjectGuid::LowType masterLow) const
+{
+    uint32 count = 0;
+    for (auto const& req : _queue)
+        if (req->masterGuid.GetCounter() == masterLow)
+            ++count;
+    for (auto const& [id, req] : _inFlight)
+    {
+        (void)id;
+        if (req->masterGuid.GetCounter() == masterLow && req->stage == SpawnStage::LOADING)
+            ++count;
+    }
+    return count;
+}
+
+uint32 BotSpawnProcessor::GetQueuePosition(ObjectGuid::LowType masterLow) const
+{
+    uint32 pos = 0;
+    for (auto const& req : _queue)
+    {
+        ++pos;
+        if (req->masterGuid.GetCounter() == masterLow)
+            return pos;
+    }
+    return 0;
+}
+
+// ─── Admission control ─────────────────────────────────────────────────────────
+SpawnAdmission BotSpawnProcessor::CheckAdmission() const
+{
+    if (_inFlight.size() >= std::max<uint32>(1, RPGBotsConfig::SpawnMaxConcurrent))
+        return SpawnAdmission::HELD_CONCURRENCY;
+
+    if (RPGBotsConfig::SpawnRealmMaxBots
+        && sBotMgr.GetBotCount() + _inFlight.size() >= RPGBotsConfig::SpawnRealmMaxBots)
+        return SpawnAdmission::HELD_BUDGET;
+
+    if (_loadHeld)
+        return SpawnAdmission::HELD_LOAD;
+
+    if (RPGBotsConfig::SpawnRatePerSecond && _tokens < 1.0f)
+        return SpawnAdmission::HELD_RATE;
+
+    return SpawnAdmission::OPEN;
+}
+
+void BotSpawnProcessor::Update(uint32 diff)
+{
+    _holderCallbacks.ProcessReadyCallbacks();
+
+    // Moving average of the world diff, gated with hysteresis so the queue
+    // doesn't flap open/closed around the threshold
+    _avgDiffMs = _avgDiffMs == 0.0f ? float(diff)
+        : _avgDiffMs + DIFF_EMA_ALPHA * (float(diff) - _avgDiffMs);
+    if (!RPGBotsConfig::SpawnMaxWorldDiff)
+        _loadHeld = false;
+    else if (_avgDiffMs > float(RPGBotsConfig::SpawnMaxWorldDiff))
+        _loadHeld = true;
+    else if (_avgDiffMs < float(RPGBotsConfig::SpawnMaxWorldDiff) * LOAD_REOPEN_FRACTION)
+        _loadHeld = false;
+
+    // Token bucket refill
+    float burst = float(std::max<uint32>(1, RPGBotsConfig::SpawnBurst));
+    if (!_primed)
+    {
+        _tokens = burst;
+        _primed = true;
+    }
+    else
+        _tokens = std::min(burst, _tokens + float(RPGBotsConfig::SpawnRatePerSecond) * float(diff) / float(IN_MILLISECONDS));
+
+    _admission = SpawnAdmission::OPEN;
+    while (!_queue.empty())
+    {
+        _admission = CheckAdmission();
+        if (_admission != SpawnAdmission::OPEN)
+            break;
+
+        std::shared_ptr<BotSpawnRequest> req = _queue.front();
+        _queue.pop_front();
+        if (Dispatch(req) && RPGBotsConfig::SpawnRatePerSecond)
+            _tokens -= 1.0f;
+    }
+
+    if (_queue.empty())
+    {
+        _notifyTimer = 0;
+        return;
+    }
+
+    ++_heldTicks[uint8(_admission)];
+
+    // Back-pressure: tell waiting masters where they stand
+    _notifyTimer += diff;
+    if (_notifyTimer >= QUEUE_NOTIFY_INTERVAL)
+    {
+        _notifyTimer = 0;
+        if (_admission != SpawnAdmission::HELD_CONCURRENCY)
+            NotifyQueuedMasters();
+    }
+}
+
+void BotSpawnProcessor::NotifyQueuedMasters()
+{
+    std::unordered_map<ObjectGuid::LowType, uint32> notified;   // master → queued count
+    uint32 pos = 0;
+    for (auto const& req : _queue)
+    {
+        ++pos;
+        auto [it, first] = notified.emplace(req->masterGuid.GetCounter(), 0);
+        ++it->second;
+        if (!first)
+            continue;
+
+        if (Player* master = ObjectAccessor::FindPlayer(req->masterGuid))
+            ChatHandler(master->GetSession()).PSendSysMessage(
+                "|cffffd700[Army] Spawns delayed ({}). You are #{} of {} in the spawn queue.|r",
+                AdmissionName(_admission), pos, uint32(_queue.size()));
+    }
+}
+
+char const* BotSpawnProcessor::AdmissionName(SpawnAdmission a)
+{
+    switch (a)
+    {
+        case SpawnAdmission::OPEN:             return "open";
+        case SpawnAdmission::HELD_CONCURRENCY: return "spawns in progress";
+        case SpawnAdmission::HELD_RATE:        return "rate limited";
+        case SpawnAdmission::HELD_BUDGET:      return "realm bot limit reached";
+        case SpawnAdmission::HELD_LOAD:        return "server under load";
+        default:                               return "?";
+    }
+}
+
+bool BotSpawnProcessor::Dispatch(std::shared_ptr<BotSpawnRequest> req)
+{
+    // The master may have left, or the alt logged in, while this sat queued
+    if (!ObjectAccessor::FindPlayer(req->masterGuid) || ObjectAccessor::FindPlayer(req->botGuid))
+    {
+        Abandon(*req, SpawnStage::CANCELLED);
+        return false;
+    }
+
+    auto queryHolder = std::make_shared<BotLoginQueryHolder>(req->accountId, req->botGuid);
+    if (!queryHolder->Initialize())
+    {
+        LOG_ERROR("module", "RPGBots: Failed to initialize login queries for bot {}", req->botName);
+        Abandon(*req, SpawnStage::FAILED);
+        return false;
+    }
+
+    // Lease the socketless session only once the spawn is actually running
+    req->session        = sBotSessionPool.Acquire(req->accountId);
+    req->stage          = SpawnStage::LOADING;
+    req->dispatchedAtUs = BotPerfNowUs();
+    _inFlight[req->id]  = req;
+
+    uint32 requestId = req->id;
+    _holderCallbacks.AddCallback(CharacterDatabase.DelayQueryHolder(queryHolder))
+        .AfterComplete([this, requestId](SQLQueryHolderBase const& holder)
+    {
+        Complete(requestId, static_cast<CharacterDatabaseQueryHolder const&>(holder));
+    });
+    return true;
+}
+
+// ─── Spawn callback (runs after DB queries complete) ───────────────────────────
+void BotSpawnProcessor::Complete(uint32 requestId, CharacterDatabaseQueryHolder const& holder)
+{
+    RPGBOTS_PERF_SCOPE(PERF_SPAWN_COMPLETE);
+
+    auto itr = _inFlight.find(requestId);
+    if (itr == _inFlight.end())
+        return;
+
+    std::shared_ptr<BotSpawnRequest> req = itr->second;
+    _inFlight.erase(itr);
+
+    WorldSession* botSession = req->session;
+    req->timingsUs[SPAWN_TIMING_QUERY] = BotPerfNowUs() - req->dispatchedAtUs;
+
+    auto fail = [&](SpawnStage stage)
+    {
+        Abandon(*req, stage);
+        sBotSessionPool.Release(botSession);
+        req->session = nullptr;
+    };
+
+    if (req->stage == SpawnStage::CANCELLED)
+    {
+        fail(SpawnStage::CANCELLED);
+        return;
+    }
+
+    Player* master = ObjectAccessor::FindPlayer(req->masterGuid);
+    if (!master)
+    {
+        LOG_ERROR("module", "RPGBots: Master player gone before bot spawn completed");
+        fail(SpawnStage::CANCELLED);
+        return;
+    }
+
+    // Create the bot Player object (this sets botSession->_player = bot)
+    Player* bot = new Player(botSession);
+
+    uint64 stageStart = BotPerfNowUs();
+    if (!bot->LoadFromDB(req->botGuid, holder))
+    {
+        LOG_ERROR("module", "RPGBots: Failed to load bot character {}", req->botGuid.ToString());
+        botSession->SetPlayer(nullptr);
+        delete bot;
+        fail(SpawnStage::FAILED);
+        return;
+    }
+    req->timingsUs[SPAWN_TIMING_LOAD] = BotPerfNowUs() - stageStart;
+
+    // Everything just read from the DB is already persisted — don't let the
+    // next save re-insert it.
+    BotSaveScheduler::MarkLoadedStateClean(bot);
+
+    bot->GetMotionMaster()->Initialize();
+
+    // Relocate bot near master with a random offset
+    float angle = frand(0.0f, 2.0f * float(M_PI));
+    float dist  = frand(2.0f, 5.0f);
+    float x = master->GetPositionX() + dist * std::cos(angle);
+    float y = master->GetPositionY() + dist * std::sin(angle);
+    float z = master->GetPositionZ();
+    float o = master->GetOrientation();
+
+    Map* masterMap = master->GetMap();
+
+    // Override bot's position and map to master's location
+    bot->Relocate(x, y, z, o);
+    bot->m_mapId = master->GetMapId();
+    bot->ResetMap();
+    bot->SetMap(masterMap);
+    bot->UpdatePositionData();
+
+    stageStart = BotPerfNowUs();
+
+    // Login state before map add (client packet burst skipped in bot mode)
+    BotInitialPacketsBeforeAddToMap(bot);
+
+    // Register in global hash maps so FindPlayer() works
+    ObjectAccessor::AddObject(bot);
+
+    // Add to map grid — this calls AddToWorld() and makes the bot visible
+    if (!masterMap->AddPlayerToMap(bot))
+    {
+        LOG_ERROR("module", "RPGBots: Failed to add bot {} to map", bot->GetName());
+        ObjectAccessor::RemoveObject(bot);
+        botSession->SetPlayer(nullptr);
+        delete bot;
+        fail(SpawnStage::FAILED);
+        return;
+    }
+
+    BotInitialPacketsAfterAddToMap(bot);
+    req->timingsUs[SPAWN_TIMING_ADD_TO_MAP] = BotPerfNowUs() - stageStart;
+
+    // Mark character as online in DB (batched with this tick's transitions)
+    sBotOnlineTracker.MarkOnline(bot->GetGUID().GetCounter(), master->GetGUID().GetCounter());
+
+    bot->SetInGameTime(GameTime::GetGameTimeMS().count());
+
+    // ── Party: create or join ──
+    stageStart = BotPerfNowUs();
+    Group* group = master->GetGroup();
+    if (!group)
+    {
+        group = new Group();
+        group->Create(master);
+    }
+    group->AddMember(bot);
+    req->timingsUs[SPAWN_TIMING_GROUP_JOIN] = BotPerfNowUs() - stageStart;
+
+    // ── Detect role and spec ──
+    BotRole role = DetectBotRole(bot);
+    uint8 specIdx = DetectSpecIndex(bot);
+
+    // Register with BotManager; a restored bot gets its roster overrides
+    ObjectGuid::LowType masterLow = master->GetGUID().GetCounter();
+    BotInfo info{ bot, botSession, role, specIdx, false, false, 0, ObjectGuid::Empty };
+    info.trace = sBotDecisionTrace.Acquire(bot->GetGUID().GetCounter());
+    sArmyRoster.OnBotSpawned(masterLow, info);
+    role = info.role;
+    sBotMgr.AddBot(masterLow, info);
+
+    // ── Start following master ──
+    bot->GetMotionMaster()->MoveFollow(master, 4.0f, float(M_PI));
+
+    // Bots never fire OnPlayerLogin — load their RPG profile here
+    LoadPersonalityProfile(bot);
+
+    req->stage = SpawnStage::DONE;
+    ++_completed;
+    Record(*req);
+
+    // Notify master
+    ChatHandler(master->GetSession()).PSendSysMessage("|cff00ff00{} has joined your party as {}!|r",
+        bot->GetName(), BotRoleName(role));
+    LOG_INFO("module", "RPGBots: Bot {} spawned as {} for {} ({} ms after queueing)",
+        bot->GetName(), BotRoleName(role), master->GetName(), getMSTimeDiff(req->queuedAtMs, getMSTime()));
+}
+
+// ─── Stats ─────────────────────────────────────────────────────────────────────
+void BotSpawnProcessor::Abandon(BotSpawnRequest& req, SpawnStage stage)
+{
+    req.stage = stage;
+    if (stage == SpawnStage::CANCELLED)
+        ++_cancelled;
+    else
+        ++_failed;
+
+    // Overrides held for a roster restore must not outlive the spawn
+    sArmyRoster.DropHeld(req.botGuid.GetCounter());
+}
+
+void BotSpawnProcessor::Record(BotSpawnRequest const& req)
+{
+    for (uint8 i = 0; i < MAX_SPAWN_TIMINGS; ++i)
+    {
+        TimingStats& s = _timing[i];
+        ++s.count;
+        s.sumUs += req.timingsUs[i];
+        s.maxUs  = std::max(s.maxUs, req.timingsUs[i]);
+    }
+}
+
+void BotSpawnProcessor::ResetStats()
+{
+    _timing    = {};
+    _completed = 0;
+    _failed    = 0;
+    _cancelled = 0;
+    _heldTicks = {};
+}
+
+char const* BotSpawnProcessor::TimingName(SpawnTiming t)
+{
+    switch (t)
+    {
+        case SPAWN_TIMING_QUERY:      return "Login query";
+        case SPAWN_TIMING_LOAD:       return "LoadFromDB";
+        case SPAWN_TIMING_ADD_TO_MAP: return "AddPlayerToMap";
+        case SPAWN_TIMING_GROUP_JOIN: return "Group join";
+        default:                      return "?";
+    }
+}
+
+// ─── World Script: dispatch + run completed holders every tick ─────────────────
+class BotSpawnWorldScript : public WorldScript
+{
+public:
+    BotSpawnWorldScript() : WorldScript("BotSpawnWorldScript") {}
+
+    void OnUpdate(uint32 diff) override
+    {
+        sBotSpawner.Update(diff);
+    }
+};
+
+// ─── .army spawnstats — spawn pipeline latency ─────────────────────────────────
+class BotSpawnCommands : public CommandScript
+{
+public:
+    BotSpawnCommands() : CommandScript("BotSpawnCommands") {}
+
+    ChatCommandTable GetCommands() const override
+    {
+        static ChatCommandTable armyTable =
+        {
+            { "spawnstats", HandleSpawnStatsCmd, SEC_GAMEMASTER, Console::Yes },
+            { "queue",      HandleQueueCmd,      SEC_PLAYER,     Console::No  },
+        };
+        static ChatCommandTable topTable =
+        {
+            { "army", armyTable },
+        };
+        return topTable;
+    }
+
+    // .army queue — where the player's pending spawns stand
+    static bool HandleQueueCmd(ChatHandler* handler)
+    {
+        Player* master = handler->GetSession()->GetPlayer();
+        if (!master)
+            return false;
+
+        ObjectGuid::LowType masterLow = master->GetGUID().GetCounter();
+        uint32 pending = sBotSpawner.GetPendingCount(masterLow);
+        if (!pending)
+        {
+            handler->PSendSysMessage("|cff00ff00[Army] You have no pending spawns.|r");
+            return true;
+        }
+
+        uint32 pos = sBotSpawner.GetQueuePosition(masterLow);
+        if (!pos)
+            handler->PSendSysMessage("|cff00ff00[Army] {} spawn(s) loading now.|r", pending);
+        else
+            handler->PSendSysMessage("|cffffd700[Army] {} spawn(s) pending. You are #{} of {} in the queue ({}).|r",
+                pending, pos, sBotSpawner.GetQueuedCount(),
+                BotSpawnProcessor::AdmissionName(sBotSpawner.GetAdmission()));
+        return true;
+    }
+
+    // .army spawnstats [reset]
+    static bool HandleSpawnStatsCmd(ChatHandler* handler, Optional<std::string> arg)
+    {
+        if (arg && *arg == "reset")
+        {
+            sBotSpawner.ResetStats();
+            handler->PSendSysMessage("|cff00ff00[Army] Spawn statistics reset.|r");
+            return true;
+        }
+
+        handler->PSendSysMessage("|cff00ff00=== Bot Spawn Pipeline ===|r");
+        handler->PSendSysMessage("  Queued: {}  In flight: {} (max {})",
+            sBotSpawner.GetQueuedCount(), sBotSpawner.GetInFlightCount(), RPGBotsConfig::SpawnMaxConcurrent);
+        handler->PSendSysMessage("  Completed: {}  Failed: {}  Cancelled: {}",
+            sBotSpawner.GetCompleted(), sBotSpawner.GetFailed(), sBotSpawner.GetCancelled());
+        handler->PSendSysMessage("  Admission: {}  World diff avg: {:.1f} ms (max {})  Tokens: {:.1f}/{}",
+            BotSpawnProcessor::AdmissionName(sBotSpawner.GetAdmission()), sBotSpawner.GetAvgDiffMs(),
+            RPGBotsConfig::SpawnMaxWorldDiff, sBotSpawner.GetTokens(), RPGBotsConfig::SpawnBurst);
+        handler->PSendSysMessage("  Realm bots: {} (budget {})  Held ticks: load {}  budget {}  rate {}",
+            sBotMgr.GetBotCount(), RPGBotsConfig::SpawnRealmMaxBots,
+            sBotSpawner.GetHeldTicks(SpawnAdmission::HELD_LOAD),
+            sBotSpawner.GetHeldTicks(SpawnAdmission::HELD_BUDGET),
+            sBotSpawner.GetHeldTicks(SpawnAdmission::HELD_RATE));
+
+        for (uint8 i = 0; i < MAX_SPAWN_TIMINGS; ++i)
+        {
+            auto const& s = sBotSpawner.GetTimingStats(SpawnTiming(i));
+            handler->PSendSysMessage("  {:<15} avg {:>8} us  max {:>8} us",
+                BotSpawnProcessor::TimingName(SpawnTiming(i)),
+                s.count ? s.sumUs / s.count : 0, s.maxUs);
+        }
+        return true;
+    }
+};
+
+void AddBotSpawnProcessor()
+{
+    new BotSpawnWorldScript();
+    new BotSpawnCommands();
+}
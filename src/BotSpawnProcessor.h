@@ -0,0 +1,167 @@
+// BotSpawnProcessor.h
+// Module-owned async spawn pipeline for bot alts.
+//
+// Login query holders used to ride on the master's session callbacks: if the
+// master logged out first the callback could be dropped with its pooled
+// session still leased, and spawns queued behind the master's own queries.
+// The processor owns its callbacks instead and tracks each request through
+// explicit stages:
+//
+//   Queued → Loading (holder in flight) → Done | Failed | Cancelled
+//
+// At most RPGBots.Spawn.MaxConcurrent holders are in flight at once.  A
+// master leaving cancels its queued requests immediately and its in-flight
+// ones when their holder completes (the session goes back to the pool).
+// Per-stage latencies (query, LoadFromDB, AddPlayerToMap, group join) are
+// aggregated for `.army spawnstats`.
+//
+// Admission control: before each dispatch the queue head must also pass
+//   - the realm-wide bot budget (live bots + in flight, RPGBots.Spawn.RealmMaxBots)
+//   - a token bucket (RPGBots.Spawn.RatePerSecond, burst RPGBots.Spawn.Burst)
+//   - a load gate on the moving average of the world diff
+//     (RPGBots.Spawn.MaxWorldDiff; reopens below 90% of the threshold)
+// While held, requests stay queued in order; masters see their position via
+// `.army queue` and a periodic notice.
+
+#pragma once
+
+#include "ObjectGuid.h"
+#include "AsyncCallbackProcessor.h"
+#include "QueryHolder.h"
+#include <array>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+class Player;
+class WorldSession;
+
+enum class SpawnStage : uint8
+{
+    QUEUED,
+    LOADING,
+    DONE,
+    FAILED,
+    CANCELLED,
+};
+
+// Why the queue head is not being dispatched
+enum class SpawnAdmission : uint8
+{
+    OPEN,
+    HELD_CONCURRENCY,   // RPGBots.Spawn.MaxConcurrent holders in flight
+    HELD_RATE,          // token bucket empty
+    HELD_BUDGET,        // realm-wide bot budget reached
+    HELD_LOAD,          // world diff average above threshold
+    MAX_SPAWN_ADMISSIONS
+};
+
+// Latency buckets reported per spawn
+enum SpawnTiming : uint8
+{
+    SPAWN_TIMING_QUERY       = 0,   // holder dispatch → callback
+    SPAWN_TIMING_LOAD        = 1,   // Player::LoadFromDB
+    SPAWN_TIMING_ADD_TO_MAP  = 2,   // Map::AddPlayerToMap (+ login state)
+    SPAWN_TIMING_GROUP_JOIN  = 3,   // Group::Create / AddMember
+    MAX_SPAWN_TIMINGS
+};
+
+struct BotSpawnRequest
+{
+    uint32        id         = 0;
+    ObjectGuid    masterGuid;
+    ObjectGuid    botGuid;
+    uint32        accountId  = 0;
+    std::string   botName;
+    WorldSession* session    = nullptr;   // leased at dispatch
+    SpawnStage    stage      = SpawnStage::QUEUED;
+    uint32        queuedAtMs = 0;
+    uint64        dispatchedAtUs = 0;
+
+    std::array<uint64, MAX_SPAWN_TIMINGS> timingsUs = {};
+};
+
+class BotSpawnProcessor
+{
+public:
+    static BotSpawnProcessor& Instance()
+    {
+        static BotSpawnProcessor instance;
+        return instance;
+    }
+
+    // Queue a spawn.  Returns the request id (0 if the alt is already pending).
+    uint32 Enqueue(Player* master, ObjectGuid botGuid, std::string const& botName);
+
+    // Cancel everything a master has queued or in flight.  Returns the count.
+    uint32 CancelForMaster(ObjectGuid::LowType masterLow);
+
+    // Feed the world diff, refill tokens, dispatch what admission allows and
+    // run completed holders
+    void Update(uint32 diff);
+
+    bool   IsPending(ObjectGuid botGuid) const;
+    uint32 GetPendingCount(ObjectGuid::LowType masterLow) const;
+    uint32 GetQueuedCount()   const { return uint32(_queue.size()); }
+    uint32 GetInFlightCount() const { return uint32(_inFlight.size()); }
+
+    // 1-based position of the master's first queued request (0 = none queued)
+    uint32 GetQueuePosition(ObjectGuid::LowType masterLow) const;
+
+    // ── Admission state ──
+    SpawnAdmission GetAdmission()  const { return _admission; }   // as of the last Update
+    SpawnAdmission CheckAdmission() const;                          // as of now (e.g. right after Enqueue)
+    float          GetAvgDiffMs()  const { return _avgDiffMs; }
+    float          GetTokens()     const { return _tokens; }
+    static char const* AdmissionName(SpawnAdmission a);
+
+    // ── Aggregated stats ──
+    struct TimingStats
+    {
+        uint64 count = 0;
+        uint64 sumUs = 0;
+        uint64 maxUs = 0;
+    };
+
+    TimingStats const& GetTimingStats(SpawnTiming t) const { return _timing[t]; }
+    uint64 GetCompleted() const { return _completed; }
+    uint64 GetFailed()    const { return _failed; }
+    uint64 GetCancelled() const { return _cancelled; }
+    uint64 GetHeldTicks(SpawnAdmission a) const { return _heldTicks[uint8(a)]; }
+    void   ResetStats();
+
+    static char const* TimingName(SpawnTiming t);
+
+private:
+    BotSpawnProcessor() = default;
+
+    bool Dispatch(std::shared_ptr<BotSpawnRequest> req);   // false if dropped
+    void Complete(uint32 requestId, CharacterDatabaseQueryHolder const& holder);
+    void Abandon(BotSpawnRequest& req, SpawnStage stage);   // FAILED / CANCELLED
+    void Record(BotSpawnRequest const& req);
+    void NotifyQueuedMasters();
+
+    uint32 _nextId = 1;
+    std::deque<std::shared_ptr<BotSpawnRequest>>                  _queue;
+    std::unordered_map<uint32, std::shared_ptr<BotSpawnRequest>>  _inFlight;
+    AsyncCallbackProcessor<SQLQueryHolderCallback>                _holderCallbacks;
+
+    std::array<TimingStats, MAX_SPAWN_TIMINGS> _timing = {};
+    uint64 _completed = 0;
+    uint64 _failed    = 0;
+    uint64 _cancelled = 0;
+
+    SpawnAdmission _admission   = SpawnAdmission::OPEN;
+    float          _avgDiffMs   = 0.0f;
+    float          _tokens      = 0.0f;
+    bool           _primed      = false;  // bucket starts full once config is loaded
+    bool           _loadHeld    = false;
+    uint32         _notifyTimer = 0;
+    std::array<uint64, size_t(SpawnAdmission::MAX_SPAWN_ADMISSIONS)> _heldTicks = {};   // indexed by SpawnAdmission
+};
+
+#define sBotSpawner BotSpawnProcessor::Instance()
+
+// Registration
+void AddBotSpawnProcessor();
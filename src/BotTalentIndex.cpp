@@ -0,0 +1,234 @@
+// BotTalentIndex.cpp
+// Startup talent index and single-pass rank state.  See BotTalentIndex.h.
+
+#include "BotTalentIndex.h"
+#include "DBCStores.h"
+#include "Player.h"
+#include "ScriptMgr.h"
+#include "SpellMgr.h"
+#include "SpellInfo.h"
+#include "Log.h"
+#include "Timer.h"
+#include <algorithm>
+
+namespace
+{
+    // ─── Hardcoded WotLK talent tree names per class ───────────────────────
+    static const char* const kTreeNames[][TALENT_TREES] =
+    {
+        /* 0  unused  */ { "", "", "" },
+        /* 1  Warrior */ { "Arms", "Fury", "Protection" },
+        /* 2  Paladin */ { "Holy", "Protection", "Retribution" },
+        /* 3  Hunter  */ { "Beast Mastery", "Marksmanship", "Survival" },
+        /* 4  Rogue   */ { "Assassination", "Combat", "Subtlety" },
+        /* 5  Priest  */ { "Discipline", "Holy", "Shadow" },
+        /* 6  DK      */ { "Blood", "Frost", "Unholy" },
+        /* 7  Shaman  */ { "Elemental", "Enhancement", "Restoration" },
+        /* 8  Mage    */ { "Arcane", "Fire", "Frost" },
+        /* 9  Warlock */ { "Affliction", "Demonology", "Destruction" },
+        /* 10 unused  */ { "", "", "" },
+        /* 11 Druid   */ { "Balance", "Feral Combat", "Restoration" },
+    };
+}
+
+char const* BotTalentIndex::TreeName(uint8 classId, uint8 tree)
+{
+    if (classId < 12 && tree < TALENT_TREES)
+        return kTreeNames[classId][tree];
+    return "Unknown";
+}
+
+std::string BotTalentIndex::TalentName(TalentNode const& node)
+{
+    if (node.rankSpells[0])
+    {
+        SpellInfo const* si = sSpellMgr->GetSpellInfo(node.rankSpells[0]);
+        if (si && si->SpellName[0])
+            return si->SpellName[0];
+    }
+    return "Unknown";
+}
+
+void BotTalentIndex::Build()
+{
+    uint32 oldMSTime = getMSTime();
+
+    for (auto& cls : _classes)
+        cls = ClassTalentIndex();
+    _rankSpells.clear();
+    _talents.clear();
+    _nodeCount = 0;
+
+    // ── Tabs: tabId → (class, tree) ────────────────────────────────────────
+    std::unordered_map<uint32, std::pair<uint8, uint8>> tabOwner;
+    for (uint32 i = 0; i < sTalentTabStore.GetNumRows(); ++i)
+    {
+        TalentTabEntry const* tab = sTalentTabStore.LookupEntry(i);
+        if (!tab || !tab->ClassMask || tab->tabpage >= TALENT_TREES)
+            continue;   // pet tabs have no class mask
+
+        for (uint8 classId = 1; classId < MAX_CLASSES; ++classId)
+        {
+            if (!(tab->ClassMask & (1u << (classId - 1))))
+                continue;
+            _classes[classId].tabIds[tab->tabpage] = tab->TalentTabID;
+            tabOwner[tab->TalentTabID] = { classId, uint8(tab->tabpage) };
+        }
+    }
+
+    // ── Talents → per-class node lists ─────────────────────────────────────
+    std::vector<uint32> prereqTalent[MAX_CLASSES];   // parallel to nodes until resolved
+    for (uint32 i = 0; i < sTalentStore.GetNumRows(); ++i)
+    {
+        TalentEntry const* t = sTalentStore.LookupEntry(i);
+        if (!t)
+            continue;
+        auto owner = tabOwner.find(t->TalentTab);
+        if (owner == tabOwner.end())
+            continue;
+
+        TalentNode node;
+        node.talentId   = t->TalentID;
+        node.tree       = owner->second.second;
+        node.row        = uint8(t->Row);
+        node.col        = uint8(t->Col);
+        node.tierPoints = uint8(t->Row * TALENT_POINTS_PER_TIER);
+        node.prereqRank = t->DependsOn ? uint8(t->DependsOnRank + 1) : 0;
+        for (uint8 r = 0; r < MAX_TALENT_RANK; ++r)
+        {
+            node.rankSpells[r] = t->RankID[r];
+            if (t->RankID[r])
+                node.maxRanks = r + 1;
+        }
+        if (!node.maxRanks)
+            continue;
+
+        // Prerequisites are talent ids here; resolved to nodes after sorting
+        _classes[owner->second.first].nodes.push_back(node);
+        prereqTalent[owner->second.first].push_back(t->DependsOn);
+    }
+
+    // ── Sort, tree ranges, lookups, prerequisites ──────────────────────────
+    for (uint8 classId = 1; classId < MAX_CLASSES; ++classId)
+    {
+        ClassTalentIndex& cls = _classes[classId];
+        if (cls.nodes.empty())
+            continue;
+
+        // Sort an index permutation so the prereq ids follow their nodes
+        std::vector<uint32> order(cls.nodes.size());
+        for (uint32 i = 0; i < order.size(); ++i)
+            order[i] = i;
+        std::sort(order.begin(), order.end(), [&cls](uint32 a, uint32 b)
+        {
+            TalentNode const& x = cls.nodes[a];
+            TalentNode const& y = cls.nodes[b];
+            if (x.tree != y.tree) return x.tree < y.tree;
+            if (x.row  != y.row)  return x.row  < y.row;
+            return x.col < y.col;
+        });
+
+        std::vector<TalentNode> sorted;
+        std::vector<uint32> sortedPrereq;
+        sorted.reserve(order.size());
+        sortedPrereq.reserve(order.size());
+        for (uint32 i : order)
+        {
+            sorted.push_back(cls.nodes[i]);
+            sortedPrereq.push_back(prereqTalent[classId][i]);
+        }
+        cls.nodes = std::move(sorted);
+
+        for (uint16 n = 0; n < cls.nodes.size(); ++n)
+        {
+            TalentNode const& node = cls.nodes[n];
+            _talents[node.talentId] = { classId, n };
+            for (uint8 r = 0; r < node.maxRanks; ++r)
+                if (node.rankSpells[r])
+                    _rankSpells[node.rankSpells[r]] = { n, classId, uint8(r + 1) };
+        }
+
+        for (uint16 n = 0; n < cls.nodes.size(); ++n)
+        {
+            if (!sortedPrereq[n])
+                continue;
+            auto it = _talents.find(sortedPrereq[n]);
+            if (it != _talents.end() && it->second.first == classId)
+                cls.nodes[n].prereq = it->second.second;
+        }
+
+        // treeBegin[t] .. treeBegin[t + 1] is tree t
+        uint16 n = 0;
+        for (uint8 t = 0; t <= TALENT_TREES; ++t)
+        {
+            while (n < cls.nodes.size() && cls.nodes[n].tree < t)
+                ++n;
+            cls.treeBegin[t] = n;
+        }
+
+        _nodeCount += uint32(cls.nodes.size());
+    }
+
+    LOG_INFO("module", "RPGBots: Talent index built: {} talents, {} rank spells in {} ms",
+        _nodeCount, _rankSpells.size(), GetMSTimeDiffToNow(oldMSTime));
+}
+
+ClassTalentIndex const* BotTalentIndex::GetClass(uint8 classId) const
+{
+    if (classId >= MAX_CLASSES || _classes[classId].nodes.empty())
+        return nullptr;
+    return &_classes[classId];
+}
+
+uint16 BotTalentIndex::FindNode(uint8 classId, uint32 talentId) const
+{
+    auto it = _talents.find(talentId);
+    if (it == _talents.end() || it->second.first != classId)
+        return TALENT_NO_NODE;
+    return it->second.second;
+}
+
+void BotTalentIndex::ComputeRanks(Player* bot, TalentRankState& out) const
+{
+    uint8 classId = bot->getClass();
+    ClassTalentIndex const* cls = GetClass(classId);
+
+    out.ranks.assign(cls ? cls->nodes.size() : 0, 0);
+    std::fill(std::begin(out.treePoints), std::end(out.treePoints), 0);
+    if (!cls)
+        return;
+
+    uint8 specMask = uint8(1 << bot->GetActiveSpec());
+    for (auto const& [spellId, talent] : bot->GetTalentMap())
+    {
+        if (talent->State == PLAYERSPELL_REMOVED || !(talent->specMask & specMask))
+            continue;
+
+        auto it = _rankSpells.find(spellId);
+        if (it == _rankSpells.end() || it->second.classId != classId)
+            continue;
+
+        uint8& rank = out.ranks[it->second.node];
+        rank = std::max(rank, it->second.rank);
+    }
+
+    for (uint16 n = 0; n < cls->nodes.size(); ++n)
+        out.treePoints[cls->nodes[n].tree] += out.ranks[n];
+}
+
+// ─── World Script: build after the DBCs are loaded ─────────────────────────────
+class BotTalentIndexWorldScript : public WorldScript
+{
+public:
+    BotTalentIndexWorldScript() : WorldScript("BotTalentIndexWorldScript") {}
+
+    void OnStartup() override
+    {
+        sBotTalentIndex.Build();
+    }
+};
+
+void AddBotTalentIndex()
+{
+    new BotTalentIndexWorldScript();
+}
@@ -0,0 +1,100 @@
+// BotTalentIndex.h
+// Per-class talent index, built once from the talent DBCs at startup.
+//
+// The talent commands used to scan all of sTalentTabStore / sTalentStore and
+// sort the result on every call, then probe HasTalent up to five times per
+// talent for the bot's ranks.  The index keeps, per class, a flat node array
+// sorted by (tree, row, col) with rank spells, the prerequisite node and the
+// tier requirement, plus a rank-spell → (node, rank) map.  A bot's full rank
+// state is then one pass over its talent map (ComputeRanks).
+
+#pragma once
+
+#include "Define.h"
+#include "DBCStructure.h"
+#include "SharedDefines.h"
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Player;
+
+static constexpr uint8  TALENT_TREES          = 3;
+static constexpr uint8  TALENT_POINTS_PER_TIER = 5;
+static constexpr uint16 TALENT_NO_NODE        = 0xFFFF;
+
+struct TalentNode
+{
+    uint32 talentId      = 0;
+    uint32 rankSpells[MAX_TALENT_RANK] = {};
+    uint16 prereq        = TALENT_NO_NODE;   // node index in the same class
+    uint8  prereqRank    = 0;                // ranks needed in prereq (1-based)
+    uint8  tree          = 0;                // 0..2 (tab page)
+    uint8  row           = 0;
+    uint8  col           = 0;
+    uint8  maxRanks      = 0;                // 1..5
+    uint8  tierPoints    = 0;                // points needed in the tree first
+};
+
+struct ClassTalentIndex
+{
+    uint32                  tabIds[TALENT_TREES] = {};
+    std::vector<TalentNode> nodes;                        // sorted by tree, row, col
+    uint16                  treeBegin[TALENT_TREES + 1] = {};  // node range per tree
+
+    bool HasTree(uint8 tree) const { return tree < TALENT_TREES && tabIds[tree]; }
+};
+
+// One bot's learned ranks, parallel to ClassTalentIndex::nodes
+struct TalentRankState
+{
+    std::vector<uint8> ranks;
+    uint32             treePoints[TALENT_TREES] = {};
+};
+
+class BotTalentIndex
+{
+public:
+    static BotTalentIndex& Instance()
+    {
+        static BotTalentIndex instance;
+        return instance;
+    }
+
+    void Build();
+
+    // nullptr for classes without talents
+    ClassTalentIndex const* GetClass(uint8 classId) const;
+
+    // Node index of a talent within its class (TALENT_NO_NODE if unknown)
+    uint16 FindNode(uint8 classId, uint32 talentId) const;
+
+    // The bot's ranks for its active spec, one pass over its talent map
+    void ComputeRanks(Player* bot, TalentRankState& out) const;
+
+    static char const* TreeName(uint8 classId, uint8 tree);
+    static std::string TalentName(TalentNode const& node);
+
+    uint32 GetNodeCount() const { return _nodeCount; }
+
+private:
+    BotTalentIndex() = default;
+
+    struct RankRef
+    {
+        uint16 node;
+        uint8  classId;
+        uint8  rank;      // 1-based
+    };
+
+    std::array<ClassTalentIndex, MAX_CLASSES>              _classes;
+    std::unordered_map<uint32, RankRef>                    _rankSpells;  // spell → node/rank
+    std::unordered_map<uint32, std::pair<uint8, uint16>>   _talents;     // talentId → class/node
+    uint32                                                 _nodeCount = 0;
+};
+
+#define sBotTalentIndex BotTalentIndex::Instance()
+
+// Registration
+void AddBotTalentIndex();
@@ -0,0 +1,202 @@
+// BotTalentPlanner.cpp
+// Build parsing, greedy fill, validation and one-shot apply.
+// See BotTalentPlanner.h.
+
+#include "BotTalentPlanner.h"
+#include "BotSaveScheduler.h"
+#include "RPGBotsDatabase.h"
+#include "Player.h"
+#include "Log.h"
+#include "ScriptMgr.h"
+#include <algorithm>
+#include <cctype>
+#include <numeric>
+
+namespace
+{
+    std::string ToLower(std::string s)
+    {
+        std::transform(s.begin(), s.end(), s.begin(), [](char c) { return char(std::tolower(uint8(c))); });
+        return s;
+    }
+}
+
+char const* TalentPlanResultName(TalentPlanResult result)
+{
+    switch (result)
+    {
+        case TalentPlanResult::OK:                return "OK";
+        case TalentPlanResult::NO_CLASS_DATA:     return "no talent data for this class";
+        case TalentPlanResult::BAD_FORMAT:        return "malformed build string";
+        case TalentPlanResult::RANK_TOO_HIGH:     return "a talent exceeds its max rank";
+        case TalentPlanResult::TIER_LOCKED:       return "a talent's tier is not unlocked";
+        case TalentPlanResult::MISSING_PREREQ:    return "a talent's prerequisite is missing";
+        case TalentPlanResult::NOT_ENOUGH_POINTS: return "not enough talent points";
+        default:                                  return "unknown";
+    }
+}
+
+void BotTalentPlanner::LoadBuilds()
+{
+    _builds.clear();
+    _buildCount = 0;
+    if (PreparedQueryResult result = RPGBotsDatabase.Query(RPGBotsDatabase.GetPreparedStatement(RPGBOTS_SEL_BOT_TALENT_BUILDS)))
+    {
+        do {
+            Field* fields = result->Fetch();
+            _builds[fields[0].Get<uint8>()][ToLower(fields[1].Get<std::string>())] = fields[2].Get<std::string>();
+            ++_buildCount;
+        } while (result->NextRow());
+    }
+    LOG_INFO("module", "RPGBots: Loaded {} talent build(s)", _buildCount);
+}
+
+std::string const* BotTalentPlanner::FindBuild(uint8 classId, std::string const& name) const
+{
+    auto cls = _builds.find(classId);
+    if (cls == _builds.end())
+        return nullptr;
+    auto it = cls->second.find(ToLower(name));
+    return it != cls->second.end() ? &it->second : nullptr;
+}
+
+TalentPlanResult BotTalentPlanner::Parse(ClassTalentIndex const& cls, std::string const& build, TalentPlan& out) const
+{
+    out.ranks.assign(cls.nodes.size(), 0);
+
+    uint8  tree = 0;
+    uint16 pos  = 0;   // talent position within the current tree
+    for (char c : build)
+    {
+        if (c == '-')
+        {
+            if (++tree >= TALENT_TREES)
+                return TalentPlanResult::BAD_FORMAT;
+            pos = 0;
+            continue;
+        }
+        if (c < '0' || c > '9')
+            return TalentPlanResult::BAD_FORMAT;
+
+        uint16 node = cls.treeBegin[tree] + pos++;
+        if (node >= cls.treeBegin[tree + 1])
+            return TalentPlanResult::BAD_FORMAT;   // more digits than talents
+        out.ranks[node] = uint8(c - '0');
+    }
+    return TalentPlanResult::OK;
+}
+
+uint32 BotTalentPlanner::PlanFill(ClassTalentIndex const& cls, TalentRankState const& current,
+                                  uint8 tree, uint32 points, TalentPlan& out) const
+{
+    out.ranks = current.ranks;
+    if (!cls.HasTree(tree))
+        return 0;
+
+    // Points below each node are counted in learn order, the same rule
+    // Validate() applies, so the result always validates.
+    uint32 running = 0;
+    uint32 added   = 0;
+    for (uint16 n = cls.treeBegin[tree]; n < cls.treeBegin[tree + 1]; ++n)
+    {
+        TalentNode const& node = cls.nodes[n];
+        uint8& rank = out.ranks[n];
+
+        bool unlocked = running >= node.tierPoints
+            && (node.prereq == TALENT_NO_NODE || out.ranks[node.prereq] >= node.prereqRank);
+        if (unlocked && points > added)
+        {
+            uint8 take = uint8(std::min<uint32>(node.maxRanks - rank, points - added));
+            rank  += take;
+            added += take;
+        }
+        running += rank;
+    }
+    return added;
+}
+
+TalentPlanResult BotTalentPlanner::Validate(ClassTalentIndex const& cls, TalentPlan const& plan, uint32 budget) const
+{
+    if (plan.ranks.size() != cls.nodes.size())
+        return TalentPlanResult::BAD_FORMAT;
+
+    uint32 total = 0;
+    for (uint8 t = 0; t < TALENT_TREES; ++t)
+    {
+        uint32 running = 0;   // points learned earlier in this tree
+        for (uint16 n = cls.treeBegin[t]; n < cls.treeBegin[t + 1]; ++n)
+        {
+            TalentNode const& node = cls.nodes[n];
+            uint8 rank = plan.ranks[n];
+            if (rank)
+            {
+                if (rank > node.maxRanks)
+                    return TalentPlanResult::RANK_TOO_HIGH;
+                if (running < node.tierPoints)
+                    return TalentPlanResult::TIER_LOCKED;
+                if (node.prereq != TALENT_NO_NODE && plan.ranks[node.prereq] < node.prereqRank)
+                    return TalentPlanResult::MISSING_PREREQ;
+            }
+            running += rank;
+        }
+        total += running;
+    }
+
+    return total > budget ? TalentPlanResult::NOT_ENOUGH_POINTS : TalentPlanResult::OK;
+}
+
+TalentPlanResult BotTalentPlanner::Apply(Player* bot, TalentPlan const& plan, uint32& learned) const
+{
+    learned = 0;
+    ClassTalentIndex const* cls = sBotTalentIndex.GetClass(bot->getClass());
+    if (!cls)
+        return TalentPlanResult::NO_CLASS_DATA;
+
+    TalentRankState state;
+    sBotTalentIndex.ComputeRanks(bot, state);
+
+    uint32 spent = std::accumulate(std::begin(state.treePoints), std::end(state.treePoints), 0u);
+    TalentPlanResult result = Validate(*cls, plan, bot->GetFreeTalentPoints() + spent);
+    if (result != TalentPlanResult::OK)
+        return result;
+
+    // A plan that drops a rank can only be reached from a clean slate
+    bool needsReset = false;
+    for (uint16 n = 0; n < cls->nodes.size() && !needsReset; ++n)
+        needsReset = plan.ranks[n] < state.ranks[n];
+    if (needsReset)
+    {
+        bot->resetTalents(true);
+        std::fill(state.ranks.begin(), state.ranks.end(), 0);
+    }
+
+    // Index order is learn order: every tier and prerequisite is already met
+    for (uint16 n = 0; n < cls->nodes.size(); ++n)
+    {
+        for (uint8 r = state.ranks[n]; r < plan.ranks[n]; ++r)
+        {
+            bot->LearnTalent(cls->nodes[n].talentId, r);
+            ++learned;
+        }
+    }
+
+    sBotSaveScheduler.MarkDirty(bot);
+    return TalentPlanResult::OK;
+}
+
+// ─── World Script: load named builds at startup ────────────────────────────────
+class BotTalentPlannerWorldScript : public WorldScript
+{
+public:
+    BotTalentPlannerWorldScript() : WorldScript("BotTalentPlannerWorldScript") {}
+
+    void OnStartup() override
+    {
+        sBotTalentPlanner.LoadBuilds();
+    }
+};
+
+void AddBotTalentPlanner()
+{
+    new BotTalentPlannerWorldScript();
+}
@@ -0,0 +1,77 @@
+// BotTalentPlanner.h
+// Offline talent planning on top of BotTalentIndex.
+//
+// A plan is the complete target rank per index node.  It is either parsed
+// from a build string (stored in bot_talent_builds or typed literally) or
+// computed greedily for one tree.  Validation then checks the points budget,
+// max ranks, tier requirements and prerequisites against the index.  Only
+// after that is it applied: nodes are learned in (tree, row, col) order, so
+// each LearnTalent call is already legal, and the bot is saved once.
+
+#pragma once
+
+#include "BotTalentIndex.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Player;
+
+struct TalentPlan
+{
+    std::vector<uint8> ranks;   // target rank per ClassTalentIndex node
+};
+
+enum class TalentPlanResult : uint8
+{
+    OK,
+    NO_CLASS_DATA,
+    BAD_FORMAT,
+    RANK_TOO_HIGH,
+    TIER_LOCKED,
+    MISSING_PREREQ,
+    NOT_ENOUGH_POINTS,
+};
+
+char const* TalentPlanResultName(TalentPlanResult result);
+
+class BotTalentPlanner
+{
+public:
+    static BotTalentPlanner& Instance()
+    {
+        static BotTalentPlanner instance;
+        return instance;
+    }
+
+    // Named builds from rpgbots.bot_talent_builds
+    void LoadBuilds();
+    std::string const* FindBuild(uint8 classId, std::string const& name) const;
+    uint32 GetBuildCount() const { return _buildCount; }
+
+    // Build string → plan (digits per tree, '-' between trees)
+    TalentPlanResult Parse(ClassTalentIndex const& cls, std::string const& build, TalentPlan& out) const;
+
+    // Greedy: add up to `points` ranks to one tree on top of `current`,
+    // top to bottom, honouring tiers and prerequisites.  Returns ranks added.
+    uint32 PlanFill(ClassTalentIndex const& cls, TalentRankState const& current,
+                    uint8 tree, uint32 points, TalentPlan& out) const;
+
+    // Tiers, prerequisites, max ranks and total points (`budget`)
+    TalentPlanResult Validate(ClassTalentIndex const& cls, TalentPlan const& plan, uint32 budget) const;
+
+    // Validate and learn the plan in one batch.  A plan below the current
+    // ranks resets the bot's talents first.  Marks the bot dirty once.
+    TalentPlanResult Apply(Player* bot, TalentPlan const& plan, uint32& learned) const;
+
+private:
+    BotTalentPlanner() = default;
+
+    std::unordered_map<uint8, std::unordered_map<std::string, std::string>> _builds;   // class → lowercase name → build
+    uint32 _buildCount = 0;
+};
+
+#define sBotTalentPlanner BotTalentPlanner::Instance()
+
+// Registration
+void AddBotTalentPlanner();
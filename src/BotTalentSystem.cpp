@@ -4,116 +4,68 @@
 //   .army talent reset <name>              — Reset all talents (free)
 //   .army talent learn <name> <talentId>   — Learn next rank of a talent
 //   .army talent list  <name> [tree]       — List talents in a tree with IDs
-//   .army talent fill  <name> <tree>       — Fill all free points into a tree
+//   .army talent fill  <name|all> <tree>   — Fill all free points into a tree
+//   .army talent apply <name|all> <build>  — Apply a named or literal build
 
 #include "ScriptMgr.h"
 #include "Chat.h"
 #include "CommandScript.h"
 #include "Player.h"
 #include "BotAI.h"
-#include "DBCStores.h"
-#include "SpellMgr.h"
-#include "SpellInfo.h"
-#include <algorithm>
-#include <vector>
+#include "BotSaveScheduler.h"
+#include "BotTalentIndex.h"
+#include "BotTalentPlanner.h"
 
 using namespace Acore::ChatCommands;
 
 namespace
 {
-    // ─── Hardcoded WotLK talent tree names per class ───────────────────────
-    static const char* const kTreeNames[][3] =
+    // The bot's class entry in the startup talent index (nullptr if none)
+    ClassTalentIndex const* GetIndex(Player* bot)
     {
-        /* 0  unused  */ { "", "", "" },
-        /* 1  Warrior */ { "Arms", "Fury", "Protection" },
-        /* 2  Paladin */ { "Holy", "Protection", "Retribution" },
-        /* 3  Hunter  */ { "Beast Mastery", "Marksmanship", "Survival" },
-        /* 4  Rogue   */ { "Assassination", "Combat", "Subtlety" },
-        /* 5  Priest  */ { "Discipline", "Holy", "Shadow" },
-        /* 6  DK      */ { "Blood", "Frost", "Unholy" },
-        /* 7  Shaman  */ { "Elemental", "Enhancement", "Restoration" },
-        /* 8  Mage    */ { "Arcane", "Fire", "Frost" },
-        /* 9  Warlock */ { "Affliction", "Demonology", "Destruction" },
-        /* 10 unused  */ { "", "", "" },
-        /* 11 Druid   */ { "Balance", "Feral Combat", "Restoration" },
-    };
-
-    const char* GetTreeName(uint8 classId, uint8 treeIdx)
-    {
-        if (classId < 12 && treeIdx < 3)
-            return kTreeNames[classId][treeIdx];
-        return "Unknown";
-    }
-
-    // ─── Map class → 3 talent tab IDs ordered by tabpage ──────────────────
-    struct ClassTabs { uint32 id[3] = {}; };
-
-    ClassTabs GetClassTabs(uint8 classId)
-    {
-        ClassTabs ct;
-        uint32 classMask = 1u << (classId - 1);
-        for (uint32 i = 0; i < sTalentTabStore.GetNumRows(); ++i)
-        {
-            auto const* tab = sTalentTabStore.LookupEntry(i);
-            if (!tab || !(tab->ClassMask & classMask)) continue;
-            if (tab->tabpage < 3)
-                ct.id[tab->tabpage] = tab->TalentTabID;
-        }
-        return ct;
-    }
-
-    // ─── Lightweight talent descriptor ─────────────────────────────────────
-    struct TalentDesc
-    {
-        uint32 talentId;
-        uint32 row, col;
-        std::array<uint32, MAX_TALENT_RANK> rankSpells;
-        uint32 maxRanks; // 1-5
-    };
-
-    // All talents in a tab, sorted by row then col
-    std::vector<TalentDesc> GetTreeTalents(uint32 tabId)
-    {
-        std::vector<TalentDesc> v;
-        for (uint32 i = 0; i < sTalentStore.GetNumRows(); ++i)
-        {
-            auto const* t = sTalentStore.LookupEntry(i);
-            if (!t || t->TalentTab != tabId) continue;
-            TalentDesc d;
-            d.talentId   = t->TalentID;
-            d.row        = t->Row;
-            d.col        = t->Col;
-            d.rankSpells = t->RankID;
-            d.maxRanks   = 0;
-            for (uint32 r = 0; r < MAX_TALENT_RANK; ++r)
-                if (t->RankID[r]) d.maxRanks = r + 1;
-            v.push_back(d);
-        }
-        std::sort(v.begin(), v.end(), [](auto& a, auto& b) {
-            return a.row != b.row ? a.row < b.row : a.col < b.col;
-        });
-        return v;
+        return sBotTalentIndex.GetClass(bot->getClass());
     }
 
-    // How many ranks the player has learned in this talent (0 = none)
-    uint32 GetCurrentRank(Player* bot, const TalentDesc& td)
+    // `build` is a stored build name for the bot's class, else a literal string
+    TalentPlanResult ApplyBuild(BotInfo& info, std::string const& build, uint32& learned)
     {
-        for (int r = MAX_TALENT_RANK - 1; r >= 0; --r)
-            if (td.rankSpells[r] && bot->HasTalent(td.rankSpells[r], bot->GetActiveSpec()))
-                return uint32(r + 1);
-        return 0;
+        learned = 0;
+        Player* bot = info.player;
+        ClassTalentIndex const* cls = GetIndex(bot);
+        if (!cls)
+            return TalentPlanResult::NO_CLASS_DATA;
+
+        std::string const* stored = sBotTalentPlanner.FindBuild(bot->getClass(), build);
+
+        TalentPlan plan;
+        TalentPlanResult result = sBotTalentPlanner.Parse(*cls, stored ? *stored : build, plan);
+        if (result == TalentPlanResult::OK)
+            result = sBotTalentPlanner.Apply(bot, plan, learned);
+
+        if (result == TalentPlanResult::OK)
+            RefreshRoleAndSpec(info);
+        return result;
     }
 
-    // Human-readable talent name from first-rank spell
-    std::string GetTalentName(const TalentDesc& td)
+    // Greedy fill of one tree with all free points
+    TalentPlanResult FillTree(BotInfo& info, uint8 tree, uint32& learned)
     {
-        if (td.rankSpells[0])
-        {
-            SpellInfo const* si = sSpellMgr->GetSpellInfo(td.rankSpells[0]);
-            if (si && si->SpellName[0])
-                return si->SpellName[0];
-        }
-        return "Unknown";
+        learned = 0;
+        Player* bot = info.player;
+        ClassTalentIndex const* cls = GetIndex(bot);
+        if (!cls)
+            return TalentPlanResult::NO_CLASS_DATA;
+
+        TalentRankState state;
+        sBotTalentIndex.ComputeRanks(bot, state);
+
+        TalentPlan plan;
+        sBotTalentPlanner.PlanFill(*cls, state, tree, bot->GetFreeTalentPoints(), plan);
+
+        TalentPlanResult result = sBotTalentPlanner.Apply(bot, plan, learned);
+        if (result == TalentPlanResult::OK)
+            RefreshRoleAndSpec(info);
+        return result;
     }
 }
 
@@ -132,6 +84,7 @@ public:
             { "learn", HandleLearnCmd, SEC_GAMEMASTER, Console::No },
             { "list",  HandleListCmd,  SEC_GAMEMASTER, Console::No },
             { "fill",  HandleFillCmd,  SEC_GAMEMASTER, Console::No },
+            { "apply", HandleApplyCmd, SEC_GAMEMASTER, Console::No },
         };
         static ChatCommandTable armyTable =
         {
@@ -159,15 +112,15 @@ public:
 
         Player* bot   = info->player;
         uint8 classId = bot->getClass();
-        ClassTabs ct  = GetClassTabs(classId);
+        ClassTalentIndex const* cls = GetIndex(bot);
 
-        uint8 pts[3] = {};
-        bot->GetTalentTreePoints(pts);
+        TalentRankState state;
+        sBotTalentIndex.ComputeRanks(bot, state);
 
         handler->PSendSysMessage("|cff00ff00=== Talents for {} ===|r", bot->GetName());
-        for (int t = 0; t < 3; ++t)
-            if (ct.id[t])
-                handler->PSendSysMessage("  {}: {} points", GetTreeName(classId, t), pts[t]);
+        for (uint8 t = 0; t < TALENT_TREES; ++t)
+            if (cls && cls->HasTree(t))
+                handler->PSendSysMessage("  {}: {} points", BotTalentIndex::TreeName(classId, t), state.treePoints[t]);
         handler->PSendSysMessage("  Free points: {}", bot->GetFreeTalentPoints());
         return true;
     }
@@ -187,9 +140,8 @@ public:
 
         Player* bot = info->player;
         bot->resetTalents(true);
-        info->specIndex = DetectSpecIndex(bot);
-        info->role      = DetectBotRole(bot);
-        bot->SaveToDB(false, true);
+        RefreshRoleAndSpec(*info);
+        sBotSaveScheduler.MarkDirty(bot);
 
         handler->PSendSysMessage("|cff00ff00{}'s talents have been reset. Free points: {}|r",
                                  name, bot->GetFreeTalentPoints());
@@ -216,22 +168,20 @@ public:
             return true;
         }
 
-        TalentEntry const* te = sTalentStore.LookupEntry(talentId);
-        if (!te)
+        ClassTalentIndex const* cls = GetIndex(bot);
+        uint16 node = sBotTalentIndex.FindNode(bot->getClass(), talentId);
+        if (!cls || node == TALENT_NO_NODE)
         {
             handler->PSendSysMessage("|cffff0000Invalid talent ID {}.|r", talentId);
             return true;
         }
 
-        // Current rank (1-indexed count, 0 = none)
-        uint32 curRank = 0;
-        for (int r = MAX_TALENT_RANK - 1; r >= 0; --r)
-            if (te->RankID[r] && bot->HasTalent(te->RankID[r], bot->GetActiveSpec()))
-            { curRank = r + 1; break; }
+        TalentRankState state;
+        sBotTalentIndex.ComputeRanks(bot, state);
 
-        uint32 maxRank = 0;
-        for (uint32 r = 0; r < MAX_TALENT_RANK; ++r)
-            if (te->RankID[r]) maxRank = r + 1;
+        TalentNode const& td = cls->nodes[node];
+        uint32 curRank = state.ranks[node];   // 1-indexed count, 0 = none
+        uint32 maxRank = td.maxRanks;
 
         if (curRank >= maxRank)
         {
@@ -244,16 +194,10 @@ public:
 
         if (bot->GetFreeTalentPoints() < oldPts)
         {
-            std::string talentName = "Unknown";
-            if (te->RankID[0])
-            {
-                SpellInfo const* si = sSpellMgr->GetSpellInfo(te->RankID[0]);
-                if (si && si->SpellName[0]) talentName = si->SpellName[0];
-            }
+            std::string talentName = BotTalentIndex::TalentName(td);
 
-            info->specIndex = DetectSpecIndex(bot);
-            info->role      = DetectBotRole(bot);
-            bot->SaveToDB(false, true);
+            RefreshRoleAndSpec(*info);
+            sBotSaveScheduler.MarkDirty(bot);
 
             handler->PSendSysMessage("|cff00ff00{} learned {} (rank {}/{}). Free: {}|r",
                                      name, talentName, curRank + 1, maxRank, bot->GetFreeTalentPoints());
@@ -279,20 +223,27 @@ public:
 
         Player* bot   = info->player;
         uint8 classId = bot->getClass();
-        ClassTabs ct  = GetClassTabs(classId);
+        ClassTalentIndex const* cls = GetIndex(bot);
+        if (!cls)
+        {
+            handler->PSendSysMessage("|cffff0000No talent data for {}'s class.|r", name);
+            return true;
+        }
 
-        for (uint8 t = 0; t < 3; ++t)
+        TalentRankState state;
+        sBotTalentIndex.ComputeRanks(bot, state);
+
+        for (uint8 t = 0; t < TALENT_TREES; ++t)
         {
             if (treeArg && *treeArg != t) continue;
-            if (!ct.id[t]) continue;
+            if (!cls->HasTree(t)) continue;
 
-            handler->PSendSysMessage("|cff00ff00=== {} (tree {}) ===|r", GetTreeName(classId, t), t);
-            auto talents = GetTreeTalents(ct.id[t]);
-            for (auto& td : talents)
+            handler->PSendSysMessage("|cff00ff00=== {} (tree {}) ===|r", BotTalentIndex::TreeName(classId, t), t);
+            for (uint16 n = cls->treeBegin[t]; n < cls->treeBegin[t + 1]; ++n)
             {
-                uint32 cur = GetCurrentRank(bot, td);
+                TalentNode const& td = cls->nodes[n];
                 handler->PSendSysMessage("  [{}] {} — {}/{} (Row {} Col {})",
-                    td.talentId, GetTalentName(td), cur, td.maxRanks,
+                    td.talentId, BotTalentIndex::TalentName(td), state.ranks[n], td.maxRanks,
                     td.row + 1, td.col + 1);
             }
         }
@@ -300,71 +251,153 @@ public:
         return true;
     }
 
-    // ─── .army talent fill <name> <tree> ───────────────────────────────────
+    // ─── .army talent fill <name|all> <tree> ───────────────────────────────
     // Spends all free talent points into the specified tree (0/1/2),
-    // picking talents top-to-bottom, left-to-right.
+    // picking talents top-to-bottom, left-to-right.  `all` fills every bot
+    // in the army and commits the saves in one transaction.
     static bool HandleFillCmd(ChatHandler* handler, std::string name, uint8 treeIndex)
     {
         Player* master = handler->GetSession()->GetPlayer();
         if (!master) return false;
 
-        BotInfo* info = sBotMgr.FindBot(master->GetGUID().GetCounter(), name);
-        if (!info || !info->player)
+        if (treeIndex > 2)
         {
-            handler->PSendSysMessage("|cffff0000No bot named '{}' found.|r", name);
+            handler->PSendSysMessage("|cffff0000Tree index must be 0, 1, or 2.|r");
             return true;
         }
 
-        if (treeIndex > 2)
+        ObjectGuid::LowType masterLow = master->GetGUID().GetCounter();
+
+        if (name == "all")
         {
-            handler->PSendSysMessage("|cffff0000Tree index must be 0, 1, or 2.|r");
+            std::vector<BotInfo>* bots = sBotMgr.GetBots(masterLow);
+            if (!bots || bots->empty())
+            {
+                handler->PSendSysMessage("|cffff0000You have no bots.|r");
+                return true;
+            }
+
+            uint32 filled = 0, skipped = 0, learnedTotal = 0;
+            for (BotInfo& info : *bots)
+            {
+                if (!info.player)
+                    continue;
+
+                ClassTalentIndex const* cls = GetIndex(info.player);
+                uint32 learned = 0;
+                if (!cls || !cls->HasTree(treeIndex)
+                    || FillTree(info, treeIndex, learned) != TalentPlanResult::OK || !learned)
+                {
+                    ++skipped;
+                    continue;
+                }
+                ++filled;
+                learnedTotal += learned;
+            }
+
+            uint32 saved = sBotSaveScheduler.FlushArmy(masterLow);
+            handler->PSendSysMessage("|cff00ff00Filled tree {} for {} bots ({} unchanged): {} points spent, {} saved.|r",
+                treeIndex, filled, skipped, learnedTotal, saved);
+            return true;
+        }
+
+        BotInfo* info = sBotMgr.FindBot(masterLow, name);
+        if (!info || !info->player)
+        {
+            handler->PSendSysMessage("|cffff0000No bot named '{}' found.|r", name);
             return true;
         }
 
         Player* bot   = info->player;
         uint8 classId = bot->getClass();
-        ClassTabs ct  = GetClassTabs(classId);
+        ClassTalentIndex const* cls = GetIndex(bot);
 
-        if (!ct.id[treeIndex])
+        if (!cls || !cls->HasTree(treeIndex))
         {
             handler->PSendSysMessage("|cffff0000No talent tree for index {}.|r", treeIndex);
             return true;
         }
 
-        auto talents = GetTreeTalents(ct.id[treeIndex]);
+        // Plan the whole fill up front, then learn it in one validated batch
         uint32 totalLearned = 0;
-        uint32 const maxPasses = 100; // safety bound
+        TalentPlanResult result = FillTree(*info, treeIndex, totalLearned);
+        if (result != TalentPlanResult::OK)
+        {
+            handler->PSendSysMessage("|cffff0000Fill failed: {}.|r", TalentPlanResultName(result));
+            return true;
+        }
+
+        handler->PSendSysMessage(
+            "|cff00ff00Filled {} points into {} for {}. Free: {}|r",
+            totalLearned, BotTalentIndex::TreeName(classId, treeIndex), name,
+            bot->GetFreeTalentPoints());
+        return true;
+    }
+
+    // ─── .army talent apply <name|all> <build> ─────────────────────────────
+    // <build> is a bot_talent_builds name for each bot's class, or a literal
+    // build string ("3022032123331-05-0502").  `all` applies to the whole
+    // army and commits the saves in one transaction.
+    static bool HandleApplyCmd(ChatHandler* handler, std::string name, std::string build)
+    {
+        Player* master = handler->GetSession()->GetPlayer();
+        if (!master) return false;
 
-        for (uint32 pass = 0; pass < maxPasses && bot->GetFreeTalentPoints() > 0; ++pass)
+        ObjectGuid::LowType masterLow = master->GetGUID().GetCounter();
+
+        if (name != "all")
         {
-            bool learnedAny = false;
-            for (auto& td : talents)
+            BotInfo* info = sBotMgr.FindBot(masterLow, name);
+            if (!info || !info->player)
             {
-                if (bot->GetFreeTalentPoints() == 0) break;
+                handler->PSendSysMessage("|cffff0000No bot named '{}' found.|r", name);
+                return true;
+            }
 
-                uint32 cur = GetCurrentRank(bot, td);
-                if (cur >= td.maxRanks) continue;
+            uint32 learned = 0;
+            TalentPlanResult result = ApplyBuild(*info, build, learned);
+            if (result != TalentPlanResult::OK)
+            {
+                handler->PSendSysMessage("|cffff0000Cannot apply '{}' to {}: {}.|r",
+                    build, name, TalentPlanResultName(result));
+                return true;
+            }
 
-                uint32 oldPts = bot->GetFreeTalentPoints();
-                bot->LearnTalent(td.talentId, cur); // cur = 0-indexed next rank
+            handler->PSendSysMessage("|cff00ff00Applied '{}' to {}: {} ranks learned. Free: {}|r",
+                build, name, learned, info->player->GetFreeTalentPoints());
+            return true;
+        }
 
-                if (bot->GetFreeTalentPoints() < oldPts)
-                {
-                    ++totalLearned;
-                    learnedAny = true;
-                }
-            }
-            if (!learnedAny) break;
+        std::vector<BotInfo>* bots = sBotMgr.GetBots(masterLow);
+        if (!bots || bots->empty())
+        {
+            handler->PSendSysMessage("|cffff0000You have no bots.|r");
+            return true;
         }
 
-        info->specIndex = DetectSpecIndex(bot);
-        info->role      = DetectBotRole(bot);
-        bot->SaveToDB(false, true);
+        uint32 applied = 0, failed = 0, learnedTotal = 0;
+        for (BotInfo& info : *bots)
+        {
+            if (!info.player)
+                continue;
 
-        handler->PSendSysMessage(
-            "|cff00ff00Filled {} points into {} for {}. Free: {}|r",
-            totalLearned, GetTreeName(classId, treeIndex), name,
-            bot->GetFreeTalentPoints());
+            uint32 learned = 0;
+            TalentPlanResult result = ApplyBuild(info, build, learned);
+            if (result == TalentPlanResult::OK)
+            {
+                ++applied;
+                learnedTotal += learned;
+            }
+            else
+            {
+                ++failed;
+                handler->PSendSysMessage("  |cffff0000{}: {}|r", info.player->GetName(), TalentPlanResultName(result));
+            }
+        }
+
+        uint32 saved = sBotSaveScheduler.FlushArmy(masterLow);
+        handler->PSendSysMessage("|cff00ff00Applied '{}' to {} bots ({} failed): {} ranks learned, {} saved.|r",
+            build, applied, failed, learnedTotal, saved);
         return true;
     }
 };
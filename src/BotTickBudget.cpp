@@ -0,0 +1,160 @@
+// BotTickBudget.cpp
+// World-tick budget, carry-over queues and `.army budget`.  See BotTickBudget.h.
+
+#include "BotTickBudget.h"
+#include "BotProfiler.h"
+#include "Chat.h"
+#include "CommandScript.h"
+#include "RPGBotsConfig.h"
+#include "ScriptMgr.h"
+#include "Timer.h"
+#include <algorithm>
+
+// ─── Budget ────────────────────────────────────────────────────────────────────
+void BotTickBudget::BeginTick()
+{
+    if (_spentUs)
+    {
+        ++_busyTicks;
+        _totalSpentUs += _spentUs;
+        _maxSpentUs    = std::max(_maxSpentUs, _spentUs);
+        if (RPGBotsConfig::BudgetTickUs && _spentUs > RPGBotsConfig::BudgetTickUs)
+            ++_overruns;
+    }
+
+    _spentUs = 0;
+    ++_tickId;
+}
+
+bool BotTickBudget::HasBudget() const
+{
+    return !RPGBotsConfig::BudgetTickUs || _spentUs < RPGBotsConfig::BudgetTickUs;
+}
+
+void BotTickBudget::RecordDeferral(uint32 left)
+{
+    ++_deferTicks;
+    _maxBacklog = std::max(_maxBacklog, left);
+}
+
+void BotTickBudget::RecordDeferredRun(uint32 ageMs)
+{
+    ++_deferredRuns;
+    _deferredAgeSumMs += ageMs;
+    _maxDeferredMs     = std::max(_maxDeferredMs, ageMs);
+}
+
+void BotTickBudget::ResetStats()
+{
+    _busyTicks        = 0;
+    _totalSpentUs     = 0;
+    _maxSpentUs       = 0;
+    _overruns         = 0;
+    _deferTicks       = 0;
+    _deferredRuns     = 0;
+    _deferredAgeSumMs = 0;
+    _maxDeferredMs    = 0;
+    _maxBacklog       = 0;
+}
+
+// ─── Carry-over queue ──────────────────────────────────────────────────────────
+bool BotTickQueue::Next(ObjectGuid::LowType& key)
+{
+    if (_queue.empty())
+        return false;
+
+    uint64 tick = sBotTickBudget.GetTickId();
+    if (tick != _tickId)
+    {
+        _tickId      = tick;
+        _runThisTick = 0;
+    }
+
+    // Always make progress: the first entry of a tick runs regardless
+    if (_runThisTick && !sBotTickBudget.HasBudget())
+    {
+        sBotTickBudget.RecordDeferral(uint32(_queue.size()));
+        return false;
+    }
+
+    Entry entry = _queue.front();
+    _queue.pop_front();
+    _waiting.erase(entry.key);
+    ++_runThisTick;
+
+    if (entry.queuedTick != tick)
+        sBotTickBudget.RecordDeferredRun(getMSTimeDiff(entry.queuedMs, getMSTime()));
+
+    key = entry.key;
+    return true;
+}
+
+BotBudgetCharge::BotBudgetCharge() : _startUs(BotPerfNowUs()) { }
+
+BotBudgetCharge::~BotBudgetCharge()
+{
+    sBotTickBudget.Charge(BotPerfNowUs() - _startUs);
+}
+
+// ─── World Script: open the tick's budget before the AI scripts run ────────────
+class BotTickBudgetWorldScript : public WorldScript
+{
+public:
+    BotTickBudgetWorldScript() : WorldScript("BotTickBudgetWorldScript") {}
+
+    void OnUpdate(uint32 /*diff*/) override
+    {
+        sBotTickBudget.BeginTick();
+    }
+};
+
+// ─── .army budget — overruns and deferred work ─────────────────────────────────
+class BotTickBudgetCommands : public CommandScript
+{
+public:
+    BotTickBudgetCommands() : CommandScript("BotTickBudgetCommands") {}
+
+    ChatCommandTable GetCommands() const override
+    {
+        static ChatCommandTable armyTable =
+        {
+            { "budget", HandleBudgetCmd, SEC_GAMEMASTER, Console::Yes },
+        };
+        static ChatCommandTable topTable =
+        {
+            { "army", armyTable },
+        };
+        return topTable;
+    }
+
+    // .army budget [reset]
+    static bool HandleBudgetCmd(ChatHandler* handler, Optional<std::string> arg)
+    {
+        if (arg && *arg == "reset")
+        {
+            sBotTickBudget.ResetStats();
+            handler->PSendSysMessage("|cff00ff00[Army] Tick budget statistics reset.|r");
+            return true;
+        }
+
+        handler->PSendSysMessage("|cff00ff00=== Bot AI Tick Budget ===|r");
+        if (RPGBotsConfig::BudgetTickUs)
+            handler->PSendSysMessage("  Budget: {} us per world tick", RPGBotsConfig::BudgetTickUs);
+        else
+            handler->PSendSysMessage("  Budget: unlimited");
+        handler->PSendSysMessage("  Busy ticks: {}  avg {:.0f} us  max {} us  overruns {}",
+            sBotTickBudget.GetBusyTicks(), sBotTickBudget.GetAvgSpentUs(),
+            sBotTickBudget.GetMaxSpentUs(), sBotTickBudget.GetOverruns());
+        handler->PSendSysMessage("  Deferred: {} tick(s) stopped early (max backlog {}), {} entries ran late "
+            "(avg {:.0f} ms, max {} ms)",
+            sBotTickBudget.GetDeferTicks(), sBotTickBudget.GetMaxBacklog(), sBotTickBudget.GetDeferredRuns(),
+            sBotTickBudget.GetAvgDeferredMs(), sBotTickBudget.GetMaxDeferredMs());
+        return true;
+    }
+};
+
+void AddBotTickBudget()
+{
+    new BotTickBudgetWorldScript();
+    new BotTickBudgetCommands();
+}
@@ -0,0 +1,117 @@
+// BotTickBudget.h
+// Per-world-tick CPU budget for the bot AI loops.
+//
+// BotAIWorldScript (armies) and SelfBotWorldScript (selfbot players) share
+// one budget of RPGBots.Budget.TickUs microseconds per world tick.  Each
+// loop keeps a BotTickQueue: when its 1 s timer fires, every key not
+// already waiting is appended, and the loop pops keys until the budget is
+// spent.  Whatever is left stays at the front and runs first on the next
+// world tick, so a heavy second is spread over several ticks in
+// round-robin order and no army or player starves.  Each queue always runs
+// at least one entry per tick, so work keeps moving even on a zero budget.
+//
+// Overruns (ticks that spent more than the budget) and the age of deferred
+// entries (how long after their pass they finally ran) are kept for
+// `.army budget`.  World thread only.
+
+#pragma once
+
+#include "ObjectGuid.h"
+#include <deque>
+#include <unordered_set>
+
+class BotTickBudget
+{
+public:
+    static BotTickBudget& Instance()
+    {
+        static BotTickBudget instance;
+        return instance;
+    }
+
+    // Start of a world tick (first bot WorldScript): close the last tick's books
+    void BeginTick();
+
+    void   Charge(uint64 us) { _spentUs += us; }
+    bool   HasBudget() const;
+    uint64 GetTickId() const { return _tickId; }
+
+    // A queue stopped this tick with work left / an entry ran `ageMs` late
+    void RecordDeferral(uint32 left);
+    void RecordDeferredRun(uint32 ageMs);
+
+    uint64 GetBusyTicks()      const { return _busyTicks; }
+    uint64 GetOverruns()       const { return _overruns; }
+    uint64 GetMaxSpentUs()     const { return _maxSpentUs; }
+    uint64 GetDeferTicks()     const { return _deferTicks; }
+    uint64 GetDeferredRuns()   const { return _deferredRuns; }
+    uint32 GetMaxDeferredMs()  const { return _maxDeferredMs; }
+    uint32 GetMaxBacklog()     const { return _maxBacklog; }
+    float  GetAvgDeferredMs()  const { return _deferredRuns ? float(_deferredAgeSumMs) / float(_deferredRuns) : 0.0f; }
+    float  GetAvgSpentUs()     const { return _busyTicks ? float(_totalSpentUs) / float(_busyTicks) : 0.0f; }
+    void   ResetStats();
+
+private:
+    BotTickBudget() = default;
+
+    uint64 _tickId        = 0;
+    uint64 _spentUs       = 0;
+    uint64 _busyTicks     = 0;   // ticks that ran any bot AI
+    uint64 _totalSpentUs  = 0;
+    uint64 _maxSpentUs    = 0;
+    uint64 _overruns      = 0;
+    uint64 _deferTicks    = 0;
+    uint64 _deferredRuns  = 0;
+    uint64 _deferredAgeSumMs = 0;
+    uint32 _maxDeferredMs = 0;
+    uint32 _maxBacklog    = 0;
+};
+
+#define sBotTickBudget BotTickBudget::Instance()
+
+// ─── Carry-over queue for one AI loop ──────────────────────────────────────────
+class BotTickQueue
+{
+public:
+    // New pass: append every key of `entries` (a map keyed by LowType) not already waiting
+    template <class Map>
+    void Refill(Map const& entries, uint32 nowMs)
+    {
+        for (auto const& entry : entries)
+            if (_waiting.insert(entry.first).second)
+                _queue.push_back({ entry.first, nowMs, sBotTickBudget.GetTickId() });
+    }
+
+    // Next key to update this tick; false when empty or the budget is spent
+    bool Next(ObjectGuid::LowType& key);
+
+    bool   Empty() const { return _queue.empty(); }
+    uint32 Size()  const { return uint32(_queue.size()); }
+
+private:
+    struct Entry
+    {
+        ObjectGuid::LowType key;
+        uint32              queuedMs;
+        uint64              queuedTick;
+    };
+
+    std::deque<Entry>                       _queue;
+    std::unordered_set<ObjectGuid::LowType> _waiting;
+    uint64 _tickId  = ~uint64(0);
+    uint32 _runThisTick = 0;
+};
+
+// Charges the enclosing scope's wall time to the tick budget
+class BotBudgetCharge
+{
+public:
+    BotBudgetCharge();
+    ~BotBudgetCharge();
+
+private:
+    uint64 _startUs;
+};
+
+// Registration (before the AI scripts: opens each world tick's budget)
+void AddBotTickBudget();
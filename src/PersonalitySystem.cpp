@@ -2,109 +2,131 @@
 // Implementation of the PersonalitySystem for mod-rpgbots
 
 #include "PersonalitySystem.h"
-#include "DatabaseEnv.h"
+#include "RPGBotsDatabase.h"
 #include "Player.h"
 #include "Chat.h"
+#include "ObjectAccessor.h"
+#include "ScriptMgr.h"
 #include "Log.h"
 #include "RPGBotsConfig.h"
+#include "BotSessionSystem.h"
+#include "TraitLibrary.h"
+#include "ProfileStore.h"
+#include "ProfileXpAccumulator.h"
+#include <string_view>
 
-PersonalitySystem::PersonalitySystem() : PlayerScript("PersonalitySystem",
-    {PLAYERHOOK_ON_LOGIN, PLAYERHOOK_ON_LOGOUT, PLAYERHOOK_ON_GIVE_EXP}) {}
-
-void PersonalitySystem::OnPlayerLogin(Player* player)
+namespace
 {
-    if (!player)
-        return;
-
-    // If psych system is disabled, skip all personality logic
-    if (!RPGBotsConfig::PsychEnabled)
-        return;
-
-    uint32 guid = player->GetGUID().GetCounter();
-
-    // Check if this character already has RPG data
-    QueryResult result = CharacterDatabase.Query(
-        "SELECT mechanics, mechanics_xp, rotation, rotation_xp, heroism, heroism_xp, "
-        "temperament_id, psych_id FROM rpgbots.character_rpg_data WHERE guid = {}",
-        guid);
-
-    if (!result)
+    // System message to the player's own client.  Bot sessions have no client,
+    // so in bot mode the chat packet is never built.
+    void NotifyOwnClient(Player* player, std::string_view text)
     {
-        // First login - create default entry with random temperament & psychology
-        QueryResult tempResult = CharacterDatabase.Query(
-            "SELECT id FROM rpgbots.rpg_temperaments ORDER BY RAND() LIMIT 1");
-        QueryResult psychResult = CharacterDatabase.Query(
-            "SELECT id FROM rpgbots.rpg_psychology ORDER BY RAND() LIMIT 1");
-
-        uint32 tempId = tempResult ? (*tempResult)[0].Get<uint32>() : 1;
-        uint32 psychId = psychResult ? (*psychResult)[0].Get<uint32>() : 1;
-
-        CharacterDatabase.Execute(
-            "INSERT INTO rpgbots.character_rpg_data "
-            "(guid, mechanics, mechanics_xp, rotation, rotation_xp, heroism, heroism_xp, temperament_id, psych_id) "
-            "VALUES ({}, 1, 0, 1, 0, 1, 0, {}, {})",
-            guid, tempId, psychId);
-
-        // Apply the temperament and psychology auras
-        QueryResult spellResult = CharacterDatabase.Query(
-            "SELECT spell FROM rpgbots.rpg_temperaments WHERE id = {}", tempId);
-        if (spellResult)
-        {
-            uint32 spellId = (*spellResult)[0].Get<uint32>();
-            if (spellId)
-                player->AddAura(spellId, player);
-        }
-
-        spellResult = CharacterDatabase.Query(
-            "SELECT spell FROM rpgbots.rpg_psychology WHERE id = {}", psychId);
-        if (spellResult)
+        WorldSession* session = player->GetSession();
+        if (RPGBotsConfig::SuppressClientPackets && sBotSessionPool.IsBotSession(session))
         {
-            uint32 spellId = (*spellResult)[0].Get<uint32>();
-            if (spellId)
-                player->AddAura(spellId, player);
+            sBotSessionPool.RecordSkippedMessage(session);
+            return;
         }
+        ChatHandler(session).SendSysMessage(text);
+    }
 
-        ChatHandler(player->GetSession()).PSendSysMessage("|cff00ff00[RPG] Character RPG profile created! You have been assigned a temperament and psychology.|r");
+    void ApplyTraitAuras(Player* player, uint32 tempAura, uint32 psychAura)
+    {
+        if (tempAura)
+            player->AddAura(tempAura, player);
+        if (psychAura)
+            player->AddAura(psychAura, player);
     }
-    else
+
+    // Runs on the world thread once the profile query completes.  The store
+    // is updated even if the character left meanwhile, so XP it earned while
+    // loading is merged and written instead of dropped.
+    void HandleProfileLoaded(ObjectGuid guid, PreparedQueryResult result)
     {
-        // Returning player - load and re-apply auras
-        Field* fields = result->Fetch();
-        uint32 tempId  = fields[6].Get<uint32>();
-        uint32 psychId = fields[7].Get<uint32>();
+        Player* player = ObjectAccessor::FindPlayer(guid);
 
-        // Apply temperament aura
-        QueryResult spellResult = CharacterDatabase.Query(
-            "SELECT spell FROM rpgbots.rpg_temperaments WHERE id = {}", tempId);
-        if (spellResult)
+        // Query failed (not "no row"): never treat that as a first login, or
+        // Create would roll fresh traits over a profile we could not read
+        if (!result)
         {
-            uint32 spellId = (*spellResult)[0].Get<uint32>();
-            if (spellId)
-                player->AddAura(spellId, player);
+            LOG_ERROR("module", "RPGBots: Could not load the RPG profile of character {}; it stays unloaded this session.",
+                guid.GetCounter());
+            sProfileStore.AbortLoad(guid.GetCounter());
+            return;
         }
 
-        // Apply psychology aura
-        spellResult = CharacterDatabase.Query(
-            "SELECT spell FROM rpgbots.rpg_psychology WHERE id = {}", psychId);
-        if (spellResult)
+        if (!result->GetRowCount())
         {
-            uint32 spellId = (*spellResult)[0].Get<uint32>();
-            if (spellId)
-                player->AddAura(spellId, player);
+            // First login - create default entry with a rarity-weighted roll
+            // (id 1 / no aura if a library is empty)
+            auto library = sTraitLibrary.Get();
+            TraitEntry const* temp  = library->Roll(TraitKind::TEMPERAMENT);
+            TraitEntry const* psych = library->Roll(TraitKind::PSYCHOLOGY);
+
+            sProfileStore.Create(guid.GetCounter(), temp ? temp->id : 1, psych ? psych->id : 1);
+            if (!player)
+                return;
+
+            ApplyTraitAuras(player, temp ? temp->auraId : 0, psych ? psych->auraId : 0);
+            NotifyOwnClient(player, "|cff00ff00[RPG] Character RPG profile created! You have been assigned a temperament and psychology.|r");
+            return;
         }
 
-        ChatHandler(player->GetSession()).PSendSysMessage("|cff00ff00[RPG] Welcome back! Your RPG profile has been loaded.|r");
+        // Returning player - keep the row resident, re-apply auras
+        // (NULL if the trait row was removed)
+        Field* fields = result->Fetch();
+        RPGProfile stored{};
+        for (uint8 i = 0; i < MAX_PROFILE_STATS; ++i)
+        {
+            stored.stat[i] = fields[i * 2].Get<uint8>();
+            stored.xp[i]   = fields[i * 2 + 1].Get<uint32>();
+        }
+        stored.temperamentId = fields[6].Get<uint32>();
+        stored.psychId       = fields[7].Get<uint32>();
+        sProfileStore.OnLoaded(guid.GetCounter(), stored);
+        if (!player)
+            return;   // logged out / dismissed meanwhile
+
+        uint32 tempAura  = fields[8].IsNull() ? 0 : fields[8].Get<uint32>();
+        uint32 psychAura = fields[9].IsNull() ? 0 : fields[9].Get<uint32>();
+        ApplyTraitAuras(player, tempAura, psychAura);
+        NotifyOwnClient(player, "|cff00ff00[RPG] Welcome back! Your RPG profile has been loaded.|r");
     }
 }
 
+void LoadPersonalityProfile(Player* player)
+{
+    // If psych system is disabled, skip all personality logic
+    if (!player || !RPGBotsConfig::PsychEnabled)
+        return;
+
+    ObjectGuid guid = player->GetGUID();
+    sProfileStore.BeginLoad(guid.GetCounter());
+
+    RPGBotsDatabasePreparedStatement* stmt = RPGBotsDatabase.GetPreparedStatement(RPGBOTS_SEL_CHARACTER_RPG_DATA);
+    stmt->SetData(0, guid.GetCounter());
+    RPGBotsDatabase.AddCallback(RPGBotsDatabase.AsyncQueryChecked(stmt)).WithPreparedCallback([guid](PreparedQueryResult result)
+    {
+        HandleProfileLoaded(guid, std::move(result));
+    });
+}
+
+PersonalitySystem::PersonalitySystem() : PlayerScript("PersonalitySystem",
+    {PLAYERHOOK_ON_LOGIN, PLAYERHOOK_ON_LOGOUT, PLAYERHOOK_ON_GIVE_EXP}) {}
+
+void PersonalitySystem::OnPlayerLogin(Player* player)
+{
+    LoadPersonalityProfile(player);
+}
+
 void PersonalitySystem::OnPlayerLogout(Player* player)
 {
     if (!player)
         return;
 
-    // Save current RPG state on logout (persist any runtime changes)
-    // For now, the DB row is already saved/updated on login and via commands,
-    // but this hook can save any runtime-modified fields in the future.
+    // Write back this character's profile now rather than next interval
+    sProfileStore.Unload(player->GetGUID().GetCounter());
+
     LOG_INFO("module", "RPGBots: Player {} ({}) logged out, RPG data preserved.",
         player->GetName(), player->GetGUID().GetCounter());
 }
@@ -114,15 +136,27 @@ void PersonalitySystem::OnPlayerGiveXP(Player* player, uint32& amount, Unit* /*v
     if (!player)
         return;
 
-    // Award mechanics XP alongside normal XP (1:1 ratio for now)
-    uint32 guid = player->GetGUID().GetCounter();
-    CharacterDatabase.Execute(
-        "UPDATE rpgbots.character_rpg_data SET mechanics_xp = mechanics_xp + {} WHERE guid = {}",
-        amount, guid);
+    // Award mechanics XP alongside normal XP (1:1 ratio for now).
+    // Runs on a map thread: summed by ProfileXpAccumulator, applied to the
+    // resident profile on the next world tick and written back by RPGProfileStore.
+    sProfileXp.Add(player->GetGUID().GetCounter(), PROFILE_STAT_MECHANICS, amount);
 }
 
+// ─── World Script: load the trait library at startup ───────────────────────────
+class PersonalityWorldScript : public WorldScript
+{
+public:
+    PersonalityWorldScript() : WorldScript("PersonalityWorldScript") {}
+
+    void OnStartup() override
+    {
+        sTraitLibrary.Reload();
+    }
+};
+
 // Register the script
 void Addmod_rpgbots_PersonalitySystem()
 {
     new PersonalitySystem();
+    new PersonalityWorldScript();
 }
@@ -17,4 +17,9 @@ public:
     void OnPlayerGiveXP(Player* player, uint32& amount, Unit* victim, uint8 xpSource) override;
 };
 
+// Load (or create) the character's RPG profile asynchronously and apply its
+// trait auras when the result arrives.  Called on login, and on spawn for
+// bots (which never fire OnPlayerLogin).
+void LoadPersonalityProfile(Player* player);
+
 #endif // MODULE_RPG_BOTS_PERSONALITY_SYSTEM_H
@@ -0,0 +1,327 @@
+// ProfileStore.cpp
+// Resident RPG profiles with dirty write-back.  See ProfileStore.h.
+
+#include "ProfileStore.h"
+#include "RPGBotsConfig.h"
+#include "RollEngine.h"
+#include "Chat.h"
+#include "CommandScript.h"
+#include "ScriptMgr.h"
+#include "Log.h"
+#include <algorithm>
+
+using namespace Acore::ChatCommands;
+
+RPGProfile const* RPGProfileStore::Get(ObjectGuid::LowType guid) const
+{
+    auto it = _profiles.find(guid);
+    if (it == _profiles.end() || !it->second.profile.IsLoaded())
+        return nullptr;
+    return &it->second.profile;
+}
+
+TraitModifiers const& RPGProfileStore::GetModifiers(ObjectGuid::LowType guid) const
+{
+    static TraitModifiers const neutral;
+    auto it = _profiles.find(guid);
+    if (it == _profiles.end() || !it->second.profile.IsLoaded())
+        return neutral;
+    return it->second.modifiers;
+}
+
+void RPGProfileStore::Recompile(ObjectGuid::LowType guid, Entry& entry)
+{
+    entry.modifiers = sTraitLibrary.Get()->Compile(entry.profile.temperamentId, entry.profile.psychId);
+    sRollEngine.Rebuild(guid, entry.profile, entry.modifiers);
+}
+
+void RPGProfileStore::RecompileAll()
+{
+    for (auto& [guid, entry] : _profiles)
+        if (entry.profile.IsLoaded())
+            Recompile(guid, entry);
+}
+
+void RPGProfileStore::BeginLoad(ObjectGuid::LowType guid)
+{
+    // Keeps an already resident record (e.g. a bot re-spawned before dismiss
+    // finished, or a relog before the last load came back); the load result
+    // then simply refreshes it.
+    auto [it, inserted] = _profiles.try_emplace(guid, Entry{ RPGProfile{}, 0, TraitModifiers{} });
+    if (!inserted)
+        it->second.profile.flags &= ~PROFILE_FLAG_UNLOAD;
+}
+
+void RPGProfileStore::OnLoaded(ObjectGuid::LowType guid, RPGProfile const& stored)
+{
+    auto it = _profiles.find(guid);
+    if (it == _profiles.end())
+        return;   // evicted while the query was in flight
+
+    Entry& entry = it->second;
+    RPGProfile& profile = entry.profile;
+    if (!profile.IsLoaded())
+    {
+        // XP gathered on the pending record goes on top of the stored values
+        for (uint8 i = 0; i < MAX_PROFILE_STATS; ++i)
+        {
+            profile.xp[i]  += stored.xp[i];
+            profile.stat[i] = stored.stat[i];
+        }
+        profile.temperamentId = stored.temperamentId;
+        profile.psychId       = stored.psychId;
+        profile.flags        |= PROFILE_FLAG_LOADED;
+    }
+    ++_loads;
+
+    // Left while loading: the merged record (with any XP earned) goes out now
+    if (profile.flags & PROFILE_FLAG_UNLOAD)
+    {
+        Evict(guid);
+        return;
+    }
+    Recompile(guid, entry);
+}
+
+void RPGProfileStore::Create(ObjectGuid::LowType guid, uint32 temperamentId, uint32 psychId)
+{
+    Entry& entry = _profiles[guid];
+    RPGProfile& profile = entry.profile;
+    for (uint8 i = 0; i < MAX_PROFILE_STATS; ++i)
+        profile.stat[i] = 1;   // xp keeps anything earned while loading
+    profile.temperamentId = temperamentId;
+    profile.psychId       = psychId;
+    profile.flags        |= PROFILE_FLAG_LOADED;
+    ++_creates;
+
+    // Persist right away so a crash does not re-roll the traits
+    RPGBotsDatabaseTransaction trans = RPGBotsDatabase.BeginTransaction();
+    AppendWrite(trans, guid, entry, RPGBOTS_INS_CHARACTER_RPG_DATA);
+    RPGBotsDatabase.CommitTransaction(trans);
+    ++_transactions;
+
+    if (profile.flags & PROFILE_FLAG_UNLOAD)
+    {
+        _profiles.erase(guid);   // already written above
+        return;
+    }
+    Recompile(guid, entry);
+}
+
+void RPGProfileStore::AbortLoad(ObjectGuid::LowType guid)
+{
+    ++_loadErrors;
+
+    auto it = _profiles.find(guid);
+    if (it != _profiles.end() && !it->second.profile.IsLoaded())
+        _profiles.erase(it);
+}
+
+void RPGProfileStore::MarkDirty(Entry& entry, uint32 changes)
+{
+    entry.profile.flags |= PROFILE_FLAG_DIRTY;
+    entry.changes += changes;
+}
+
+void RPGProfileStore::ApplyPendingXp()
+{
+    if (!sProfileXp.Drain(_xpApplying))
+        return;
+
+    for (auto const& [guid, pending] : _xpApplying)
+    {
+        auto it = _profiles.find(guid);
+        if (it == _profiles.end())
+            continue;   // not resident (psych system off / not loaded)
+
+        for (uint8 i = 0; i < MAX_PROFILE_STATS; ++i)
+            it->second.profile.xp[i] += pending.deltas[i];
+        MarkDirty(it->second, pending.events);
+        _xpEvents += pending.events;
+    }
+    _xpApplying.clear();
+}
+
+void RPGProfileStore::SetTraits(ObjectGuid::LowType guid, uint32 temperamentId, uint32 psychId)
+{
+    auto it = _profiles.find(guid);
+    if (it == _profiles.end() || !it->second.profile.IsLoaded())
+        return;
+
+    RPGProfile& profile = it->second.profile;
+    if (profile.temperamentId == temperamentId && profile.psychId == psychId)
+        return;
+
+    profile.temperamentId = temperamentId;
+    profile.psychId       = psychId;
+    MarkDirty(it->second);
+    Recompile(guid, it->second);
+}
+
+void RPGProfileStore::AppendWrite(RPGBotsDatabaseTransaction& trans, ObjectGuid::LowType guid, Entry& entry,
+                                  RPGBotsDatabaseStatements index)
+{
+    RPGProfile const& profile = entry.profile;
+
+    RPGBotsDatabasePreparedStatement* stmt = RPGBotsDatabase.GetPreparedStatement(index);
+    stmt->SetData(0, guid);
+    stmt->SetData(1, profile.stat[PROFILE_STAT_MECHANICS]);
+    stmt->SetData(2, profile.xp[PROFILE_STAT_MECHANICS]);
+    stmt->SetData(3, profile.stat[PROFILE_STAT_ROTATION]);
+    stmt->SetData(4, profile.xp[PROFILE_STAT_ROTATION]);
+    stmt->SetData(5, profile.stat[PROFILE_STAT_HEROISM]);
+    stmt->SetData(6, profile.xp[PROFILE_STAT_HEROISM]);
+    stmt->SetData(7, profile.temperamentId);
+    stmt->SetData(8, profile.psychId);
+    trans->Append(stmt);
+
+    _flushedChanges += entry.changes;
+    ++_rowsWritten;
+    entry.changes = 0;
+    entry.profile.flags &= ~PROFILE_FLAG_DIRTY;
+}
+
+void RPGProfileStore::Unload(ObjectGuid::LowType guid)
+{
+    // XP queued this tick belongs in the final write
+    ApplyPendingXp();
+
+    auto it = _profiles.find(guid);
+    if (it == _profiles.end())
+        return;
+
+    // A record still loading has nothing safe to write over the stored row
+    // yet; keep it (and its XP) until the load result is merged
+    if (!it->second.profile.IsLoaded())
+    {
+        it->second.profile.flags |= PROFILE_FLAG_UNLOAD;
+        return;
+    }
+    Evict(guid);
+}
+
+void RPGProfileStore::Evict(ObjectGuid::LowType guid)
+{
+    auto it = _profiles.find(guid);
+    if (it == _profiles.end())
+        return;
+
+    if (it->second.profile.IsDirty())
+    {
+        RPGBotsDatabaseTransaction trans = RPGBotsDatabase.BeginTransaction();
+        AppendWrite(trans, guid, it->second);
+        RPGBotsDatabase.CommitTransaction(trans);
+        ++_transactions;
+    }
+    _profiles.erase(it);
+    sRollEngine.Forget(guid);
+}
+
+uint32 RPGProfileStore::FlushAll()
+{
+    ApplyPendingXp();
+
+    RPGBotsDatabaseTransaction trans;
+    uint32 written = 0;
+    for (auto& [guid, entry] : _profiles)
+    {
+        if (!entry.profile.IsLoaded() || !entry.profile.IsDirty())
+            continue;
+        if (!trans)
+            trans = RPGBotsDatabase.BeginTransaction();
+        AppendWrite(trans, guid, entry);
+        ++written;
+    }
+
+    if (trans)
+    {
+        RPGBotsDatabase.CommitTransaction(trans);
+        ++_transactions;
+    }
+    return written;
+}
+
+void RPGProfileStore::Update(uint32 diff)
+{
+    ApplyPendingXp();
+
+    _timer += diff;
+    if (_timer < RPGBotsConfig::ProfileFlushMs)
+        return;
+    _timer = 0;
+
+    if (uint32 written = FlushAll())
+        LOG_DEBUG("module", "RPGBots: Wrote back {} dirty RPG profile(s)", written);
+}
+
+uint32 RPGProfileStore::GetLoadingCount() const
+{
+    return uint32(std::count_if(_profiles.begin(), _profiles.end(),
+        [](auto const& p) { return !p.second.profile.IsLoaded(); }));
+}
+
+uint32 RPGProfileStore::GetDirtyCount() const
+{
+    return uint32(std::count_if(_profiles.begin(), _profiles.end(),
+        [](auto const& p) { return p.second.profile.IsDirty(); }));
+}
+
+// ─── World Script: interval write-back + final flush on shutdown ───────────────
+class RPGProfileStoreWorldScript : public WorldScript
+{
+public:
+    RPGProfileStoreWorldScript() : WorldScript("RPGProfileStoreWorldScript") {}
+
+    void OnUpdate(uint32 diff) override
+    {
+        sProfileStore.Update(diff);
+    }
+
+    void OnShutdown() override
+    {
+        if (uint32 written = sProfileStore.FlushAll())
+            LOG_INFO("module", "RPGBots: Shutdown wrote back {} RPG profile(s)", written);
+    }
+};
+
+// ─── .rpg profiles — store counters ────────────────────────────────────────────
+class RPGProfileStoreCommands : public CommandScript
+{
+public:
+    RPGProfileStoreCommands() : CommandScript("RPGProfileStoreCommands") {}
+
+    ChatCommandTable GetCommands() const override
+    {
+        static ChatCommandTable rpgTable =
+        {
+            { "profiles", HandleProfilesCmd, SEC_GAMEMASTER, Console::Yes },
+        };
+        static ChatCommandTable topTable =
+        {
+            { "rpg", rpgTable },
+        };
+        return topTable;
+    }
+
+    static bool HandleProfilesCmd(ChatHandler* handler)
+    {
+        handler->PSendSysMessage("|cff00ff00=== RPG Profile Store ===|r");
+        handler->PSendSysMessage("  Resident: {}  Loading: {}  Dirty: {}",
+            sProfileStore.GetResidentCount(), sProfileStore.GetLoadingCount(), sProfileStore.GetDirtyCount());
+        handler->PSendSysMessage("  Loaded: {}  Created: {}  Load errors: {}  XP events: {}",
+            sProfileStore.GetLoads(), sProfileStore.GetCreates(), sProfileStore.GetLoadErrors(),
+            sProfileStore.GetXpEvents());
+        handler->PSendSysMessage("  Rows written: {} in {} transaction(s) (every {}s)",
+            sProfileStore.GetRowsWritten(), sProfileStore.GetTransactions(),
+            RPGBotsConfig::ProfileFlushMs / IN_MILLISECONDS);
+        handler->PSendSysMessage("  Write reduction: {:.1f} changes per row",
+            sProfileStore.GetWriteReduction());
+        return true;
+    }
+};
+
+void AddRPGProfileStore()
+{
+    new RPGProfileStoreWorldScript();
+    new RPGProfileStoreCommands();
+}
@@ -0,0 +1,142 @@
+// ProfileStore.h
+// Resident copy of character_rpg_data for every online character.
+//
+// A profile is loaded asynchronously at login / bot spawn (the joined query
+// in PersonalitySystem) and then lives here as a compact POD record.  Hot
+// code reads it with Get() instead of querying; XP and trait changes mutate
+// the record and set its dirty flag.  Dirty records are written back with
+// one REPLACE per character inside one async transaction:
+//   - every RPGBots.Profile.FlushInterval seconds (all dirty records)
+//   - at logout / bot dismissal (that character, then it is evicted)
+//   - at shutdown (all dirty records, before the rpgbots pool closes)
+// XP earned while the load is still in flight is kept on the pending record
+// and added to the loaded values; a character that leaves before its load
+// completes keeps the record until the load merges and writes it.  Every
+// profile change recompiles the character's TraitModifiers block and
+// RollEngine thresholds.  `.rpg profiles` reports the counters.
+//
+// Everything runs on the world thread.  XP awards arrive from map-update
+// threads through ProfileXpAccumulator, which sums them per character; the
+// store drains it every tick and before any write, so no award is left out
+// of a logout or shutdown write.
+
+#pragma once
+
+#include "ObjectGuid.h"
+#include "ProfileXpAccumulator.h"
+#include "RPGBotsDatabase.h"
+#include "TraitLibrary.h"
+#include <unordered_map>
+
+enum RPGProfileFlags : uint8
+{
+    PROFILE_FLAG_LOADED = 0x01,   // DB values applied (otherwise load in flight)
+    PROFILE_FLAG_DIRTY  = 0x02,   // differs from the stored row
+    PROFILE_FLAG_UNLOAD = 0x04,   // character gone while loading: write and evict on load
+};
+
+struct RPGProfile
+{
+    uint32 xp[MAX_PROFILE_STATS];     // progress toward next rank
+    uint32 temperamentId;
+    uint32 psychId;
+    uint8  stat[MAX_PROFILE_STATS];   // current % chance (0-100)
+    uint8  flags;
+
+    bool IsLoaded() const { return flags & PROFILE_FLAG_LOADED; }
+    bool IsDirty()  const { return flags & PROFILE_FLAG_DIRTY; }
+};
+
+class RPGProfileStore
+{
+public:
+    static RPGProfileStore& Instance()
+    {
+        static RPGProfileStore instance;
+        return instance;
+    }
+
+    // Loaded profile, or nullptr while absent / still loading
+    RPGProfile const* Get(ObjectGuid::LowType guid) const;
+
+    // Compiled trait modifiers (neutral defaults while absent / loading)
+    TraitModifiers const& GetModifiers(ObjectGuid::LowType guid) const;
+
+    // Recompile every resident profile after the trait library changed
+    void RecompileAll();
+
+    // Open a pending record before the async load is issued
+    void BeginLoad(ObjectGuid::LowType guid);
+
+    // Apply the stored row; XP earned meanwhile is kept on top of it
+    void OnLoaded(ObjectGuid::LowType guid, RPGProfile const& stored);
+
+    // First login: fresh profile, written immediately with INSERT IGNORE so
+    // it can never replace a stored row
+    void Create(ObjectGuid::LowType guid, uint32 temperamentId, uint32 psychId);
+
+    // The load query failed: drop the pending record (and the XP queued on
+    // it) rather than guess at a first login
+    void AbortLoad(ObjectGuid::LowType guid);
+
+    void SetTraits(ObjectGuid::LowType guid, uint32 temperamentId, uint32 psychId);
+
+    // Write back if dirty and evict (logout / dismiss).  A record still
+    // loading is kept until OnLoaded/Create merges and writes it.
+    void Unload(ObjectGuid::LowType guid);
+
+    // Write every dirty record.  Returns the number of rows written.
+    uint32 FlushAll();
+
+    void Update(uint32 diff);
+
+    uint32 GetResidentCount() const { return uint32(_profiles.size()); }
+    uint32 GetLoadingCount()  const;
+    uint32 GetDirtyCount()    const;
+    uint64 GetLoads()         const { return _loads; }
+    uint64 GetCreates()       const { return _creates; }
+    uint64 GetLoadErrors()    const { return _loadErrors; }
+    uint64 GetXpEvents()      const { return _xpEvents; }
+    uint64 GetRowsWritten()   const { return _rowsWritten; }
+    uint64 GetTransactions()  const { return _transactions; }
+
+    // Mutations folded into each row actually written
+    double GetWriteReduction() const
+    {
+        return _rowsWritten ? double(_flushedChanges) / double(_rowsWritten) : 0.0;
+    }
+
+private:
+    RPGProfileStore() = default;
+
+    struct Entry
+    {
+        RPGProfile     profile;
+        uint32         changes;   // mutations since the last write
+        TraitModifiers modifiers;
+    };
+
+    void ApplyPendingXp();
+    void Evict(ObjectGuid::LowType guid);
+    void MarkDirty(Entry& entry, uint32 changes = 1);
+    void Recompile(ObjectGuid::LowType guid, Entry& entry);
+    void AppendWrite(RPGBotsDatabaseTransaction& trans, ObjectGuid::LowType guid, Entry& entry,
+                     RPGBotsDatabaseStatements index = RPGBOTS_REP_CHARACTER_RPG_DATA);
+
+    std::unordered_map<ObjectGuid::LowType, Entry> _profiles;
+
+    ProfileXpBatch _xpApplying;   // drained from sProfileXp, buckets reused
+    uint32 _timer          = 0;
+    uint64 _loads          = 0;
+    uint64 _creates        = 0;
+    uint64 _loadErrors     = 0;
+    uint64 _xpEvents       = 0;
+    uint64 _flushedChanges = 0;
+    uint64 _rowsWritten    = 0;
+    uint64 _transactions   = 0;
+};
+
+#define sProfileStore RPGProfileStore::Instance()
+
+// Registration
+void AddRPGProfileStore();
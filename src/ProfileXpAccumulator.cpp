@@ -0,0 +1,25 @@
+// ProfileXpAccumulator.cpp
+// Per-character XP deltas from the map threads.  See ProfileXpAccumulator.h.
+
+#include "ProfileXpAccumulator.h"
+
+void ProfileXpAccumulator::Add(ObjectGuid::LowType guid, ProfileStat stat, uint32 amount)
+{
+    if (!amount)
+        return;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    ProfileXpDelta& pending = _pending[guid];
+    pending.deltas[stat] += amount;
+    ++pending.events;
+}
+
+bool ProfileXpAccumulator::Drain(ProfileXpBatch& out)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_pending.empty())
+        return false;
+
+    _pending.swap(out);
+    return true;
+}
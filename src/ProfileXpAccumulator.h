@@ -0,0 +1,50 @@
+// ProfileXpAccumulator.h
+// Thread-safe intake for RPG profile XP (mechanics / rotation / heroism).
+//
+// XP hooks fire on map-update threads, so they cannot touch the resident
+// profile records.  Add() sums each award into a per-GUID delta under a
+// lock; a burst of kills by one character stays a single map entry.  Once
+// per world tick (and before any profile write) RPGProfileStore swaps the
+// whole map out with Drain() and applies one delta per character.  Nothing
+// here talks to the database.
+
+#pragma once
+
+#include "ObjectGuid.h"
+#include "TraitLibrary.h"
+#include <array>
+#include <mutex>
+#include <unordered_map>
+
+struct ProfileXpDelta
+{
+    std::array<uint32, MAX_PROFILE_STATS> deltas{};
+    uint32 events = 0;   // awards folded into this delta
+};
+
+using ProfileXpBatch = std::unordered_map<ObjectGuid::LowType, ProfileXpDelta>;
+
+class ProfileXpAccumulator
+{
+public:
+    static ProfileXpAccumulator& Instance()
+    {
+        static ProfileXpAccumulator instance;
+        return instance;
+    }
+
+    // Any thread
+    void Add(ObjectGuid::LowType guid, ProfileStat stat, uint32 amount);
+
+    // World thread: swap the accumulated deltas into `out` (expected empty,
+    // its buckets are reused next time).  Returns false if nothing was pending.
+    bool Drain(ProfileXpBatch& out);
+
+private:
+    ProfileXpAccumulator() = default;
+
+    std::mutex     _lock;
+    ProfileXpBatch _pending;   // guarded by _lock
+};
+
+#define sProfileXp ProfileXpAccumulator::Instance()
@@ -6,11 +6,44 @@
 #include "Config.h"
 #include "Log.h"
 #include "ScriptMgr.h"
+#include "Common.h"
+#include <algorithm>
 
 // ── static defaults (overwritten on config load) ─────────────────────────────
 bool   RPGBotsConfig::PsychEnabled   = true;
 bool   RPGBotsConfig::SelfBotEnabled = true;
 uint32 RPGBotsConfig::AltArmyMaxBots = 4;
+uint32 RPGBotsConfig::SaveIntervalMs = 60 * IN_MILLISECONDS;
+uint32 RPGBotsConfig::ProfileFlushMs = 30 * IN_MILLISECONDS;
+uint32 RPGBotsConfig::SessionPoolMaxIdle = 32;
+uint32 RPGBotsConfig::SessionDrainMs = 10 * IN_MILLISECONDS;
+bool   RPGBotsConfig::SuppressClientPackets = true;
+uint32 RPGBotsConfig::SpawnMaxConcurrent = 4;
+uint32 RPGBotsConfig::SpawnRealmMaxBots  = 0;
+uint32 RPGBotsConfig::SpawnRatePerSecond = 2;
+uint32 RPGBotsConfig::SpawnBurst         = 8;
+uint32 RPGBotsConfig::SpawnMaxWorldDiff  = 150;
+std::string RPGBotsConfig::DatabaseInfo;
+uint8  RPGBotsConfig::DatabaseWorkerThreads = 1;
+uint8  RPGBotsConfig::DatabaseSynchThreads  = 1;
+uint64 RPGBotsConfig::RollSeed              = 0;
+bool   RPGBotsConfig::RollRotationMisfire   = false;
+bool   RPGBotsConfig::EquipOnAcquire        = false;
+bool   RPGBotsConfig::RosterRestore         = true;
+uint32 RPGBotsConfig::RosterRestoreDelayMs  = 3000;
+uint32 RPGBotsConfig::RosterRestoreIntervalMs = 500;
+bool   RPGBotsConfig::HibernateEnabled      = true;
+uint32 RPGBotsConfig::HibernateIdleMs       = 300000;
+uint32 RPGBotsConfig::HibernateRestIdleMs   = 30000;
+bool   RPGBotsConfig::HibernateHide         = false;
+bool   RPGBotsConfig::LodEnabled            = true;
+float  RPGBotsConfig::LodObserverRange      = 60.0f;
+uint32 RPGBotsConfig::LodLoadHighMs         = 100;
+uint32 RPGBotsConfig::LodLoadCriticalMs     = 200;
+uint32 RPGBotsConfig::LodDowngradeDelayMs   = 10000;
+uint32 RPGBotsConfig::BudgetTickUs          = 5000;
+uint32 RPGBotsConfig::ProfilerLogIntervalMs = 300000;
+uint32 RPGBotsConfig::TraceEntries          = 128;
 
 // ── WorldScript that fires before the config is fully committed ──────────────
 class RPGBotsConfigLoader : public WorldScript
@@ -28,12 +61,53 @@ public:
         RPGBotsConfig::PsychEnabled   = sConfigMgr->GetOption<bool>("RPGBots.Psych.Enable", true);
         RPGBotsConfig::SelfBotEnabled = sConfigMgr->GetOption<bool>("RPGBots.SelfBot.Enable", true);
         RPGBotsConfig::AltArmyMaxBots = sConfigMgr->GetOption<uint32>("RPGBots.AltArmy.MaxBots", 4);
+        RPGBotsConfig::SaveIntervalMs = std::max<uint32>(1,
+            sConfigMgr->GetOption<uint32>("RPGBots.Save.Interval", 60)) * IN_MILLISECONDS;
+        RPGBotsConfig::ProfileFlushMs = std::max<uint32>(1,
+            sConfigMgr->GetOption<uint32>("RPGBots.Profile.FlushInterval", 30)) * IN_MILLISECONDS;
+        RPGBotsConfig::SessionPoolMaxIdle = sConfigMgr->GetOption<uint32>("RPGBots.SessionPool.MaxIdle", 32);
+        RPGBotsConfig::SessionDrainMs = sConfigMgr->GetOption<uint32>("RPGBots.SessionPool.DrainTime", 10) * IN_MILLISECONDS;
+        RPGBotsConfig::SuppressClientPackets = sConfigMgr->GetOption<bool>("RPGBots.Bot.SuppressClientPackets", true);
+        RPGBotsConfig::SpawnMaxConcurrent = std::max<uint32>(1,
+            sConfigMgr->GetOption<uint32>("RPGBots.Spawn.MaxConcurrent", 4));
+        RPGBotsConfig::SpawnRealmMaxBots  = sConfigMgr->GetOption<uint32>("RPGBots.Spawn.RealmMaxBots", 0);
+        RPGBotsConfig::SpawnRatePerSecond = sConfigMgr->GetOption<uint32>("RPGBots.Spawn.RatePerSecond", 2);
+        RPGBotsConfig::SpawnBurst         = std::max<uint32>(1,
+            sConfigMgr->GetOption<uint32>("RPGBots.Spawn.Burst", 8));
+        RPGBotsConfig::SpawnMaxWorldDiff  = sConfigMgr->GetOption<uint32>("RPGBots.Spawn.MaxWorldDiff", 150);
+        RPGBotsConfig::DatabaseInfo          = sConfigMgr->GetOption<std::string>("RPGBots.Database.Info", "");
+        RPGBotsConfig::DatabaseWorkerThreads = sConfigMgr->GetOption<uint8>("RPGBots.Database.WorkerThreads", 1);
+        RPGBotsConfig::DatabaseSynchThreads  = sConfigMgr->GetOption<uint8>("RPGBots.Database.SynchThreads", 1);
+        RPGBotsConfig::RollSeed              = sConfigMgr->GetOption<uint64>("RPGBots.Roll.Seed", 0);
+        RPGBotsConfig::RollRotationMisfire   = sConfigMgr->GetOption<bool>("RPGBots.Roll.RotationMisfire", false);
+        RPGBotsConfig::EquipOnAcquire        = sConfigMgr->GetOption<bool>("RPGBots.Equip.OnAcquire", false);
+        RPGBotsConfig::RosterRestore         = sConfigMgr->GetOption<bool>("RPGBots.Roster.Restore", true);
+        RPGBotsConfig::RosterRestoreDelayMs  =
+            sConfigMgr->GetOption<uint32>("RPGBots.Roster.RestoreDelay", 3) * IN_MILLISECONDS;
+        RPGBotsConfig::RosterRestoreIntervalMs = sConfigMgr->GetOption<uint32>("RPGBots.Roster.RestoreInterval", 500);
+        RPGBotsConfig::HibernateEnabled      = sConfigMgr->GetOption<bool>("RPGBots.Hibernate.Enable", true);
+        RPGBotsConfig::HibernateIdleMs       =
+            sConfigMgr->GetOption<uint32>("RPGBots.Hibernate.IdleTime", 300) * IN_MILLISECONDS;
+        RPGBotsConfig::HibernateRestIdleMs   =
+            sConfigMgr->GetOption<uint32>("RPGBots.Hibernate.RestIdleTime", 30) * IN_MILLISECONDS;
+        RPGBotsConfig::HibernateHide         = sConfigMgr->GetOption<bool>("RPGBots.Hibernate.Hide", false);
+        RPGBotsConfig::LodEnabled            = sConfigMgr->GetOption<bool>("RPGBots.Lod.Enable", true);
+        RPGBotsConfig::LodObserverRange      = sConfigMgr->GetOption<float>("RPGBots.Lod.ObserverRange", 60.0f);
+        RPGBotsConfig::LodLoadHighMs         = sConfigMgr->GetOption<uint32>("RPGBots.Lod.LoadHigh", 100);
+        RPGBotsConfig::LodLoadCriticalMs     = sConfigMgr->GetOption<uint32>("RPGBots.Lod.LoadCritical", 200);
+        RPGBotsConfig::LodDowngradeDelayMs   =
+            sConfigMgr->GetOption<uint32>("RPGBots.Lod.DowngradeDelay", 10) * IN_MILLISECONDS;
+        RPGBotsConfig::BudgetTickUs          = sConfigMgr->GetOption<uint32>("RPGBots.Budget.TickUs", 5000);
+        RPGBotsConfig::ProfilerLogIntervalMs =
+            sConfigMgr->GetOption<uint32>("RPGBots.Profiler.LogInterval", 300) * IN_MILLISECONDS;
+        RPGBotsConfig::TraceEntries          = std::min<uint32>(sConfigMgr->GetOption<uint32>("RPGBots.Trace.Entries", 128), 4096);
 
-        LOG_INFO("module", "RPGBots config {}loaded: Psych={}, SelfBot={}, MaxBots={}",
+        LOG_INFO("module", "RPGBots config {}loaded: Psych={}, SelfBot={}, MaxBots={}, SaveInterval={}s",
             reload ? "re" : "",
             RPGBotsConfig::PsychEnabled  ? "ON" : "OFF",
             RPGBotsConfig::SelfBotEnabled ? "ON" : "OFF",
-            RPGBotsConfig::AltArmyMaxBots);
+            RPGBotsConfig::AltArmyMaxBots,
+            RPGBotsConfig::SaveIntervalMs / IN_MILLISECONDS);
     }
 };
 
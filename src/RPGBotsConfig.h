@@ -7,12 +7,44 @@
 #define RPGBOTS_CONFIG_H
 
 #include "Define.h"
+#include <string>
 
 struct RPGBotsConfig
 {
     static bool   PsychEnabled;     // RPGBots.Psych.Enable
     static bool   SelfBotEnabled;   // RPGBots.SelfBot.Enable
     static uint32 AltArmyMaxBots;   // RPGBots.AltArmy.MaxBots
+    static uint32 SaveIntervalMs;   // RPGBots.Save.Interval (seconds in config)
+    static uint32 ProfileFlushMs;   // RPGBots.Profile.FlushInterval (seconds in config)
+    static uint32 SessionPoolMaxIdle; // RPGBots.SessionPool.MaxIdle
+    static uint32 SessionDrainMs;     // RPGBots.SessionPool.DrainTime (seconds in config)
+    static bool   SuppressClientPackets; // RPGBots.Bot.SuppressClientPackets
+    static uint32 SpawnMaxConcurrent; // RPGBots.Spawn.MaxConcurrent
+    static uint32 SpawnRealmMaxBots;  // RPGBots.Spawn.RealmMaxBots (0 = unlimited)
+    static uint32 SpawnRatePerSecond; // RPGBots.Spawn.RatePerSecond (0 = unlimited)
+    static uint32 SpawnBurst;         // RPGBots.Spawn.Burst
+    static uint32 SpawnMaxWorldDiff;  // RPGBots.Spawn.MaxWorldDiff (ms, 0 = off)
+    static std::string DatabaseInfo;  // RPGBots.Database.Info (empty = character DB creds, rpgbots schema)
+    static uint8  DatabaseWorkerThreads; // RPGBots.Database.WorkerThreads
+    static uint8  DatabaseSynchThreads;  // RPGBots.Database.SynchThreads
+    static uint64 RollSeed;              // RPGBots.Roll.Seed (0 = random)
+    static bool   RollRotationMisfire;   // RPGBots.Roll.RotationMisfire
+    static bool   EquipOnAcquire;        // RPGBots.Equip.OnAcquire
+    static bool   RosterRestore;         // RPGBots.Roster.Restore
+    static uint32 RosterRestoreDelayMs;  // RPGBots.Roster.RestoreDelay (seconds in config)
+    static uint32 RosterRestoreIntervalMs; // RPGBots.Roster.RestoreInterval
+    static bool   HibernateEnabled;      // RPGBots.Hibernate.Enable
+    static uint32 HibernateIdleMs;       // RPGBots.Hibernate.IdleTime (seconds in config, 0 = off)
+    static uint32 HibernateRestIdleMs;   // RPGBots.Hibernate.RestIdleTime (seconds in config, 0 = off)
+    static bool   HibernateHide;         // RPGBots.Hibernate.Hide
+    static bool   LodEnabled;            // RPGBots.Lod.Enable
+    static float  LodObserverRange;      // RPGBots.Lod.ObserverRange (yards, 0 = never observed)
+    static uint32 LodLoadHighMs;         // RPGBots.Lod.LoadHigh (0 = off)
+    static uint32 LodLoadCriticalMs;     // RPGBots.Lod.LoadCritical (0 = off)
+    static uint32 LodDowngradeDelayMs;   // RPGBots.Lod.DowngradeDelay (seconds in config)
+    static uint32 BudgetTickUs;          // RPGBots.Budget.TickUs (0 = unlimited)
+    static uint32 ProfilerLogIntervalMs; // RPGBots.Profiler.LogInterval (seconds in config, 0 = off)
+    static uint32 TraceEntries;          // RPGBots.Trace.Entries (per bot, 0 = off)
 };
 
 #endif // RPGBOTS_CONFIG_H
@@ -0,0 +1,422 @@
+// RPGBotsDatabase.cpp
+// rpgbots connection pool, statement list and lifecycle scripts.
+// See RPGBotsDatabase.h.
+
+#include "RPGBotsDatabase.h"
+#include "RPGBotsConfig.h"
+#include "MySQLPreparedStatement.h"
+#include "ScriptMgr.h"
+#include "Config.h"
+#include "Log.h"
+#include "World.h"
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <thread>
+
+// ─── Statements ────────────────────────────────────────────────────────────────
+// Connections are opened on the rpgbots schema, so tables are unqualified.
+void RPGBotsDatabaseConnection::DoPrepareStatements()
+{
+    if (!m_reconnecting)
+        m_stmts.resize(MAX_RPGBOTSDATABASE_STATEMENTS);
+
+    // Profile + both trait auras in one round trip
+    PrepareStatement(RPGBOTS_SEL_CHARACTER_RPG_DATA,
+        "SELECT d.mechanics, d.mechanics_xp, d.rotation, d.rotation_xp, d.heroism, d.heroism_xp, "
+        "d.temperament_id, d.psych_id, t.aura_id, p.aura_id "
+        "FROM character_rpg_data d "
+        "LEFT JOIN rpg_temperaments t ON t.id = d.temperament_id "
+        "LEFT JOIN rpg_psychology p ON p.id = d.psych_id "
+        "WHERE d.guid = ?", CONNECTION_ASYNC);
+    // New profile: never overwrites a row that exists after all
+    PrepareStatement(RPGBOTS_INS_CHARACTER_RPG_DATA,
+        "INSERT IGNORE INTO character_rpg_data "
+        "(guid, mechanics, mechanics_xp, rotation, rotation_xp, heroism, heroism_xp, temperament_id, psych_id) "
+        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?)", CONNECTION_ASYNC);
+    // Full row from RPGProfileStore (dirty write-back of loaded records)
+    PrepareStatement(RPGBOTS_REP_CHARACTER_RPG_DATA,
+        "REPLACE INTO character_rpg_data "
+        "(guid, mechanics, mechanics_xp, rotation, rotation_xp, heroism, heroism_xp, temperament_id, psych_id) "
+        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?)", CONNECTION_ASYNC);
+
+    PrepareStatement(RPGBOTS_SEL_TEMPERAMENTS,
+        "SELECT id, name, rarity, aura_id FROM rpg_temperaments", CONNECTION_SYNCH);
+    PrepareStatement(RPGBOTS_SEL_PSYCHOLOGIES,
+        "SELECT id, name, rarity, aura_id FROM rpg_psychology", CONNECTION_SYNCH);
+    PrepareStatement(RPGBOTS_SEL_TRAIT_MODIFIERS,
+        "SELECT trait_kind, trait_id, mechanics_mult, rotation_mult, heroism_mult, mood_swing, roll_offset, "
+        "reaction_delay_ms, defensive_hp_offset, heal_threshold_offset FROM rpg_trait_modifiers", CONNECTION_SYNCH);
+
+    //  SELECT mirrors the column order in the CREATE TABLE
+    PrepareStatement(RPGBOTS_SEL_BOT_ROTATIONS,
+        "SELECT class_id, spec_index, spec_name, role, preferred_range, "
+        "       ability_1, ability_2, ability_3, ability_4, ability_5, "
+        "       buff_1, buff_2, buff_3, buff_4, buff_5, "
+        "       defensive_1, defensive_2, defensive_3, defensive_4, defensive_5, "
+        "       dot_1, dot_2, dot_3, dot_4, dot_5, "
+        "       hot_1, hot_2, hot_3, hot_4, hot_5, "
+        "       mobility_1, mobility_2, mobility_3, mobility_4, mobility_5 "
+        "FROM bot_rotations", CONNECTION_SYNCH);
+
+    PrepareStatement(RPGBOTS_SEL_BOT_TALENT_BUILDS,
+        "SELECT class_id, name, build FROM bot_talent_builds", CONNECTION_SYNCH);
+
+    //  Weight columns in StatWeightIndex order
+    PrepareStatement(RPGBOTS_SEL_BOT_STAT_WEIGHTS,
+        "SELECT class_id, spec_index, strength, agility, stamina, intellect, spirit, "
+        "       attack_power, spell_power, hit_rating, crit_rating, haste_rating, "
+        "       expertise_rating, armor_pen_rating, defense_rating, dodge_rating, parry_rating, "
+        "       block_rating, block_value, mp5, armor, melee_dps, ranged_dps, socket, weapon_mask "
+        "FROM bot_stat_weights", CONNECTION_SYNCH);
+
+    PrepareStatement(RPGBOTS_SEL_ARMY_ROSTER,
+        "SELECT bot_guid, role_override, spec_override, formation FROM army_roster WHERE master_guid = ?", CONNECTION_ASYNC);
+    PrepareStatement(RPGBOTS_REP_ARMY_ROSTER,
+        "REPLACE INTO army_roster (master_guid, bot_guid, role_override, spec_override, formation) "
+        "VALUES (?, ?, ?, ?, ?)", CONNECTION_ASYNC);
+    PrepareStatement(RPGBOTS_DEL_ARMY_ROSTER_BOT,
+        "DELETE FROM army_roster WHERE master_guid = ? AND bot_guid = ?", CONNECTION_ASYNC);
+    PrepareStatement(RPGBOTS_DEL_ARMY_ROSTER,
+        "DELETE FROM army_roster WHERE master_guid = ?", CONNECTION_ASYNC);
+    // Formation is per master; every row carries it
+    PrepareStatement(RPGBOTS_UPD_ARMY_ROSTER_FORMATION,
+        "UPDATE army_roster SET formation = ? WHERE master_guid = ?", CONNECTION_ASYNC);
+}
+
+RPGBotsDatabaseConnection::RPGBotsDatabaseConnection(MySQLConnectionInfo& connInfo)
+    : MySQLConnection(connInfo) { }
+
+RPGBotsDatabaseConnection::RPGBotsDatabaseConnection(ProducerConsumerQueue<SQLOperation*>* q, MySQLConnectionInfo& connInfo)
+    : MySQLConnection(q, connInfo) { }
+
+RPGBotsDatabaseConnection::~RPGBotsDatabaseConnection() = default;
+
+uint32 RPGBotsDatabaseConnection::GetStatementParamCount(uint32 index) const
+{
+    if (index >= m_stmts.size() || !m_stmts[index])
+        return 0;
+    return m_stmts[index]->GetParameterCount();
+}
+
+// ─── Tasks ─────────────────────────────────────────────────────────────────────
+namespace
+{
+    // Keepalive for whichever async worker picks it up
+    class PingTask : public SQLOperation
+    {
+    public:
+        bool Execute() override
+        {
+            m_conn->Ping();
+            return true;
+        }
+    };
+
+    // PreparedStatementTask hands back null for both "no rows" and "query
+    // failed".  This one passes the result set through untouched, so null
+    // means the query failed and an empty set means there was no row.
+    class CheckedQueryTask : public SQLOperation
+    {
+    public:
+        explicit CheckedQueryTask(PreparedStatementBase* stmt) : _stmt(stmt) { }
+        ~CheckedQueryTask() override { delete _stmt; }
+
+        bool Execute() override
+        {
+            PreparedResultSet* result = m_conn->Query(_stmt);
+            _result.set_value(PreparedQueryResult(result));
+            return result != nullptr;
+        }
+
+        PreparedQueryResultFuture GetFuture() { return _result.get_future(); }
+
+    private:
+        PreparedStatementBase*     _stmt;
+        PreparedQueryResultPromise _result;
+    };
+}
+
+// ─── Pool ──────────────────────────────────────────────────────────────────────
+bool RPGBotsDatabasePool::Open(std::string const& infoString, uint8 asyncThreads, uint8 synchThreads)
+{
+    if (_open)
+        return true;
+
+    _connectionInfo = std::make_unique<MySQLConnectionInfo>(infoString);
+    _queue = std::make_unique<ProducerConsumerQueue<SQLOperation*>>();
+
+    auto openOne = [](std::unique_ptr<RPGBotsDatabaseConnection>& conn) -> bool
+    {
+        if (uint32 error = conn->Open())
+        {
+            LOG_ERROR("module", "RPGBots: Could not connect to the rpgbots database (MySQL error {})", error);
+            return false;
+        }
+        if (!conn->PrepareStatements())
+        {
+            LOG_ERROR("module", "RPGBots: Could not prepare rpgbots statements — is the schema up to date?");
+            return false;
+        }
+        return true;
+    };
+
+    for (uint8 i = 0; i < std::max<uint8>(1, asyncThreads); ++i)
+    {
+        _asyncConnections.push_back(std::make_unique<RPGBotsDatabaseConnection>(_queue.get(), *_connectionInfo));
+        if (!openOne(_asyncConnections.back()))
+        {
+            Close();
+            return false;
+        }
+    }
+
+    for (uint8 i = 0; i < std::max<uint8>(1, synchThreads); ++i)
+    {
+        _synchConnections.push_back(std::make_unique<RPGBotsDatabaseConnection>(*_connectionInfo));
+        if (!openOne(_synchConnections.back()))
+        {
+            Close();
+            return false;
+        }
+    }
+
+    // A statement may be prepared only on the async or only on the synch
+    // side; take the count from whichever connection has it.
+    _paramCounts.assign(MAX_RPGBOTSDATABASE_STATEMENTS, 0);
+    for (uint32 i = 0; i < MAX_RPGBOTSDATABASE_STATEMENTS; ++i)
+        _paramCounts[i] = uint8(std::max(_asyncConnections.front()->GetStatementParamCount(i),
+                                         _synchConnections.front()->GetStatementParamCount(i)));
+
+    _open = true;
+    LOG_INFO("module", "RPGBots: rpgbots database pool opened ({} async, {} synch connection(s), {} statements)",
+        _asyncConnections.size(), _synchConnections.size(), uint32(MAX_RPGBOTSDATABASE_STATEMENTS));
+    return true;
+}
+
+void RPGBotsDatabasePool::Close()
+{
+    if (_queue)
+    {
+        // Let queued writes land before the workers are stopped
+        for (uint32 waited = 0; !_queue->Empty() && waited < 30000; waited += 10)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    _open = false;
+    _asyncConnections.clear();   // stops and joins each worker
+    _synchConnections.clear();
+    _queue.reset();
+    _connectionInfo.reset();
+}
+
+void RPGBotsDatabasePool::KeepAlive()
+{
+    if (!_open)
+        return;
+
+    // Synch connections in use are alive anyway
+    for (auto& conn : _synchConnections)
+    {
+        if (conn->TryLock())
+        {
+            conn->Ping();
+            conn->Release();
+        }
+    }
+
+    // The async workers share one queue: one ping per worker, like the core
+    // pools.  A busy worker may take two; the ping is harmless either way.
+    for (size_t i = 0; i < _asyncConnections.size(); ++i)
+        _queue->Push(new PingTask());
+}
+
+RPGBotsDatabasePreparedStatement* RPGBotsDatabasePool::GetPreparedStatement(RPGBotsDatabaseStatements index)
+{
+    uint8 capacity = index < _paramCounts.size() ? _paramCounts[index] : 0;
+    return new RPGBotsDatabasePreparedStatement(index, capacity);
+}
+
+void RPGBotsDatabasePool::Execute(RPGBotsDatabasePreparedStatement* stmt)
+{
+    if (!_open)
+    {
+        delete stmt;
+        return;
+    }
+    _queue->Push(new PreparedStatementTask(stmt));
+}
+
+QueryCallback RPGBotsDatabasePool::AsyncQuery(RPGBotsDatabasePreparedStatement* stmt)
+{
+    if (!_open)
+    {
+        delete stmt;
+        std::promise<PreparedQueryResult> empty;
+        empty.set_value(PreparedQueryResult(nullptr));
+        return QueryCallback(empty.get_future());
+    }
+
+    PreparedStatementTask* task = new PreparedStatementTask(stmt, true);
+    PreparedQueryResultFuture result = task->GetFuture();
+    _queue->Push(task);
+    return QueryCallback(std::move(result));
+}
+
+QueryCallback RPGBotsDatabasePool::AsyncQueryChecked(RPGBotsDatabasePreparedStatement* stmt)
+{
+    if (!_open)
+    {
+        delete stmt;
+        std::promise<PreparedQueryResult> failed;
+        failed.set_value(PreparedQueryResult(nullptr));
+        return QueryCallback(failed.get_future());
+    }
+
+    CheckedQueryTask* task = new CheckedQueryTask(stmt);
+    PreparedQueryResultFuture result = task->GetFuture();
+    _queue->Push(task);
+    return QueryCallback(std::move(result));
+}
+
+RPGBotsDatabaseTransaction RPGBotsDatabasePool::BeginTransaction()
+{
+    return std::make_shared<Transaction<RPGBotsDatabaseConnection>>();
+}
+
+void RPGBotsDatabasePool::CommitTransaction(RPGBotsDatabaseTransaction trans)
+{
+    if (!_open || !trans || trans->GetSize() == 0)
+        return;
+    _queue->Push(new TransactionTask(trans));
+}
+
+QueryCallback& RPGBotsDatabasePool::AddCallback(QueryCallback&& callback)
+{
+    return _callbacks.AddCallback(std::move(callback));
+}
+
+void RPGBotsDatabasePool::ProcessCallbacks()
+{
+    _callbacks.ProcessReadyCallbacks();
+}
+
+RPGBotsDatabaseConnection* RPGBotsDatabasePool::LockSynchConnection()
+{
+    // Same strategy as the core pools: spin over the synch connections until
+    // one is free.
+    for (uint8 i = 0;; ++i)
+    {
+        auto& conn = _synchConnections[i % _synchConnections.size()];
+        if (conn->TryLock())
+            return conn.get();
+    }
+}
+
+PreparedQueryResult RPGBotsDatabasePool::Query(RPGBotsDatabasePreparedStatement* stmt)
+{
+    if (!_open)
+    {
+        delete stmt;
+        return PreparedQueryResult(nullptr);
+    }
+
+    RPGBotsDatabaseConnection* conn = LockSynchConnection();
+    PreparedResultSet* ret = conn->Query(stmt);
+    conn->Release();
+    delete stmt;
+
+    if (!ret || !ret->GetRowCount())
+    {
+        delete ret;
+        return PreparedQueryResult(nullptr);
+    }
+    return PreparedQueryResult(ret);
+}
+
+// ─── Connection string ─────────────────────────────────────────────────────────
+namespace
+{
+    // RPGBots.Database.Info, or the character DB credentials pointed at the
+    // rpgbots schema ("host;port;user;password;database").
+    std::string ResolveConnectionInfo()
+    {
+        if (!RPGBotsConfig::DatabaseInfo.empty())
+            return RPGBotsConfig::DatabaseInfo;
+
+        std::string charInfo = sConfigMgr->GetOption<std::string>("CharacterDatabaseInfo", "");
+        std::vector<std::string> tokens;
+        size_t start = 0;
+        for (size_t pos; (pos = charInfo.find(';', start)) != std::string::npos; start = pos + 1)
+            tokens.push_back(charInfo.substr(start, pos - start));
+        tokens.push_back(charInfo.substr(start));
+
+        if (tokens.size() < 5)
+            return "";
+
+        tokens[4] = "rpgbots";
+        std::string info;
+        for (size_t i = 0; i < tokens.size(); ++i)
+            info += (i ? ";" : "") + tokens[i];
+        return info;
+    }
+}
+
+// ─── World Scripts: open after config load, run callbacks, close last ─────────
+class RPGBotsDatabaseWorldScript : public WorldScript
+{
+public:
+    RPGBotsDatabaseWorldScript() : WorldScript("RPGBotsDatabaseWorldScript") {}
+
+    void OnAfterConfigLoad(bool reload) override
+    {
+        // Connection settings only apply at startup
+        if (reload)
+            return;
+
+        std::string info = ResolveConnectionInfo();
+        if (info.empty())
+        {
+            LOG_ERROR("module", "RPGBots: No rpgbots database configured (RPGBots.Database.Info / CharacterDatabaseInfo)");
+            return;
+        }
+
+        RPGBotsDatabase.Open(info, RPGBotsConfig::DatabaseWorkerThreads, RPGBotsConfig::DatabaseSynchThreads);
+    }
+
+    void OnUpdate(uint32 diff) override
+    {
+        RPGBotsDatabase.ProcessCallbacks();
+
+        // Same interval the core uses for its own pools (MaxPingTime)
+        _pingTimer += diff;
+        if (_pingTimer < sWorld->getIntConfig(CONFIG_DB_PING_INTERVAL) * MINUTE * IN_MILLISECONDS)
+            return;
+        _pingTimer = 0;
+        RPGBotsDatabase.KeepAlive();
+    }
+
+private:
+    uint32 _pingTimer = 0;
+};
+
+class RPGBotsDatabaseShutdownScript : public WorldScript
+{
+public:
+    RPGBotsDatabaseShutdownScript() : WorldScript("RPGBotsDatabaseShutdownScript") {}
+
+    void OnShutdown() override
+    {
+        RPGBotsDatabase.Close();
+    }
+};
+
+void AddRPGBotsDatabase()
+{
+    new RPGBotsDatabaseWorldScript();
+}
+
+void AddRPGBotsDatabaseShutdown()
+{
+    new RPGBotsDatabaseShutdownScript();
+}
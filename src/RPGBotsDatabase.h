@@ -0,0 +1,147 @@
+// RPGBotsDatabase.h
+// Dedicated connection pool + prepared statements for the rpgbots schema.
+//
+// Module traffic used to go through CharacterDatabase as ad-hoc strings,
+// sharing its worker queue with core character saves and being re-parsed on
+// every call.  This pool owns its own connections to the rpgbots database:
+//   - async connections share one operation queue (one worker thread each);
+//     Execute / AsyncQuery / CommitTransaction go here and never block
+//   - synchronous connections serve startup loads and GM commands
+//   - every statement is prepared once per connection (RPGBOTS_* below)
+//
+// The core only instantiates DatabaseWorkerPool for its own three databases,
+// so the pool is built directly on MySQLConnection + ProducerConsumerQueue,
+// which keeps the module free of core patches.  Async query callbacks are run
+// once per world tick by RPGBotsDatabaseWorldScript, which also pings idle
+// connections every MaxPingTime minutes, as the core does for its pools, so
+// MySQL's wait_timeout does not drop them.
+
+#pragma once
+
+#include "MySQLConnection.h"
+#include "PreparedStatement.h"
+#include "QueryCallback.h"
+#include "QueryResult.h"
+#include "Transaction.h"
+#include "AsyncCallbackProcessor.h"
+#include "PCQueue.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+enum RPGBotsDatabaseStatements : uint32
+{
+    /*  Naming standard for defines:
+        {DB}_{SEL/INS/UPD/DEL/REP}_{Summary of data changed}
+        When updating more than one field, consider looking at the calling function
+        name for a suiting suffix.
+    */
+
+    // character_rpg_data
+    RPGBOTS_SEL_CHARACTER_RPG_DATA,
+    RPGBOTS_INS_CHARACTER_RPG_DATA,
+    RPGBOTS_REP_CHARACTER_RPG_DATA,
+
+    // Trait libraries
+    RPGBOTS_SEL_TEMPERAMENTS,
+    RPGBOTS_SEL_PSYCHOLOGIES,
+    RPGBOTS_SEL_TRAIT_MODIFIERS,
+
+    // bot_rotations
+    RPGBOTS_SEL_BOT_ROTATIONS,
+
+    // bot_talent_builds
+    RPGBOTS_SEL_BOT_TALENT_BUILDS,
+
+    // bot_stat_weights
+    RPGBOTS_SEL_BOT_STAT_WEIGHTS,
+
+    // army_roster
+    RPGBOTS_SEL_ARMY_ROSTER,
+    RPGBOTS_REP_ARMY_ROSTER,
+    RPGBOTS_DEL_ARMY_ROSTER_BOT,
+    RPGBOTS_DEL_ARMY_ROSTER,
+    RPGBOTS_UPD_ARMY_ROSTER_FORMATION,
+
+    MAX_RPGBOTSDATABASE_STATEMENTS
+};
+
+class RPGBotsDatabaseConnection : public MySQLConnection
+{
+public:
+    typedef RPGBotsDatabaseStatements Statements;
+
+    RPGBotsDatabaseConnection(MySQLConnectionInfo& connInfo);
+    RPGBotsDatabaseConnection(ProducerConsumerQueue<SQLOperation*>* q, MySQLConnectionInfo& connInfo);
+    ~RPGBotsDatabaseConnection() override;
+
+    void DoPrepareStatements() override;
+
+    // Bound parameter count of a prepared statement (0 if not prepared here)
+    uint32 GetStatementParamCount(uint32 index) const;
+
+    bool TryLock() { return LockIfReady(); }
+    void Release() { Unlock(); }
+};
+
+using RPGBotsDatabasePreparedStatement = PreparedStatement<RPGBotsDatabaseConnection>;
+using RPGBotsDatabaseTransaction       = SQLTransaction<RPGBotsDatabaseConnection>;
+
+class RPGBotsDatabasePool
+{
+public:
+    static RPGBotsDatabasePool& Instance()
+    {
+        static RPGBotsDatabasePool instance;
+        return instance;
+    }
+
+    // Connect and prepare every statement.  Returns false (and logs) on error;
+    // the pool then stays closed and every call below is a no-op.
+    bool Open(std::string const& infoString, uint8 asyncThreads, uint8 synchThreads);
+
+    // Wait for queued async work, then disconnect
+    void Close();
+
+    bool IsOpen() const { return _open; }
+
+    // Ping every connection that is idle (same as DatabaseWorkerPool::KeepAlive)
+    void KeepAlive();
+
+    // Caller fills the parameters; ownership passes back on Execute/Query/Append.
+    RPGBotsDatabasePreparedStatement* GetPreparedStatement(RPGBotsDatabaseStatements index);
+
+    // ── Async (default) ──
+    void Execute(RPGBotsDatabasePreparedStatement* stmt);
+    QueryCallback AsyncQuery(RPGBotsDatabasePreparedStatement* stmt);
+    // As AsyncQuery, but only a failed query yields a null result; no rows
+    // yields an empty result set.  For lookups whose "not found" branch writes.
+    QueryCallback AsyncQueryChecked(RPGBotsDatabasePreparedStatement* stmt);
+    RPGBotsDatabaseTransaction BeginTransaction();
+    void CommitTransaction(RPGBotsDatabaseTransaction trans);
+
+    // Register a callback; it runs on the world thread in ProcessCallbacks()
+    QueryCallback& AddCallback(QueryCallback&& callback);
+    void ProcessCallbacks();
+
+    // ── Synchronous (startup loads, GM commands) ──
+    PreparedQueryResult Query(RPGBotsDatabasePreparedStatement* stmt);
+
+private:
+    RPGBotsDatabasePool() = default;
+    RPGBotsDatabaseConnection* LockSynchConnection();
+
+    std::unique_ptr<MySQLConnectionInfo>                       _connectionInfo;
+    std::unique_ptr<ProducerConsumerQueue<SQLOperation*>>      _queue;
+    std::vector<std::unique_ptr<RPGBotsDatabaseConnection>>    _asyncConnections;
+    std::vector<std::unique_ptr<RPGBotsDatabaseConnection>>    _synchConnections;
+    std::vector<uint8>                                         _paramCounts;
+    QueryCallbackProcessor                                     _callbacks;
+    bool                                                       _open = false;
+};
+
+#define RPGBotsDatabase RPGBotsDatabasePool::Instance()
+
+// Registration
+void AddRPGBotsDatabase();
+void AddRPGBotsDatabaseShutdown();
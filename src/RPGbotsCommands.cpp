@@ -1,52 +1,18 @@
 // RPGbotsCommands.cpp
-// Adds commands to give a random temperament or psychology aura from the DB
+// Adds commands to give a random temperament or psychology aura from the trait library
 
 #include "Chat.h"
 #include "CommandScript.h"
 #include "ScriptMgr.h"
 #include "Player.h"
-#include "DatabaseEnv.h"
+#include "BotItemScore.h"
+#include "BotTalentPlanner.h"
+#include "ProfileStore.h"
 #include "RPGBotsConfig.h"
-#include <vector>
-#include <random>
+#include "TraitLibrary.h"
 
 using namespace Acore::ChatCommands;
 
-namespace
-{
-    // Helper to get a random aura_id from a table
-    uint32 GetRandomAuraIdFromTable(const char* table)
-    {
-        QueryResult result = CharacterDatabase.Query("SELECT spell FROM {}", table);
-        std::vector<uint32> auraIds;
-        if (result)
-        {
-            do {
-                auraIds.push_back((*result)[0].Get<uint32>());
-            } while (result->NextRow());
-        }
-        if (auraIds.empty())
-            return 0;
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_int_distribution<> dis(0, auraIds.size() - 1);
-        return auraIds[dis(gen)];
-    }
-
-    // Remove all auras from a list of aura_ids
-    void RemoveAuras(Player* player, const char* table)
-    {
-        QueryResult result = CharacterDatabase.Query("SELECT spell FROM {}", table);
-        if (result)
-        {
-            do {
-                uint32 auraId = (*result)[0].Get<uint32>();
-                player->RemoveAurasDueToSpell(auraId);
-            } while (result->NextRow());
-        }
-    }
-} // anonymous namespace
-
 class RPGbotsCommands : public CommandScript
 {
 public:
@@ -78,17 +44,38 @@ public:
         Player* player = handler->GetSession()->GetPlayer();
         if (!player)
             return false;
-        RemoveAuras(player, "rpgbots.rpg_temperaments");
-        uint32 auraId = GetRandomAuraIdFromTable("rpgbots.rpg_temperaments");
-        if (auraId)
+        return GiveRandomTrait(handler, player, TraitKind::TEMPERAMENT);
+    }
+
+    // Swap the player's trait aura of one kind for a rarity-weighted roll
+    static bool GiveRandomTrait(ChatHandler* handler, Player* player, TraitKind kind)
+    {
+        auto library = sTraitLibrary.Get();
+        library->RemoveTraitAuras(player, kind);
+
+        TraitEntry const* trait = library->Roll(kind);
+        if (trait && trait->auraId)
         {
-            player->AddAura(auraId, player);
-            handler->PSendSysMessage("You have been given a new random temperament.");
+            player->AddAura(trait->auraId, player);
+
+            // Persist the reroll through the resident profile
+            ObjectGuid::LowType guid = player->GetGUID().GetCounter();
+            if (RPGProfile const* profile = sProfileStore.Get(guid))
+            {
+                if (kind == TraitKind::TEMPERAMENT)
+                    sProfileStore.SetTraits(guid, trait->id, profile->psychId);
+                else
+                    sProfileStore.SetTraits(guid, profile->temperamentId, trait->id);
+            }
+
+            handler->PSendSysMessage("You have been given a new random {}: {} ({}).",
+                kind == TraitKind::TEMPERAMENT ? "temperament" : "psychology",
+                trait->name, TraitRarityName(trait->rarity));
         }
-        else
-        {
+        else if (kind == TraitKind::TEMPERAMENT)
             handler->PSendSysMessage("No temperaments found in the database.");
-        }
+        else
+            handler->PSendSysMessage("No psychologies found in the database.");
         return true;
     }
 
@@ -103,39 +90,33 @@ public:
         Player* player = handler->GetSession()->GetPlayer();
         if (!player)
             return false;
-        RemoveAuras(player, "rpgbots.rpg_psychology");
-        uint32 auraId = GetRandomAuraIdFromTable("rpgbots.rpg_psychology");
-        if (auraId)
-        {
-            player->AddAura(auraId, player);
-            handler->PSendSysMessage("You have been given a new random psychology.");
-        }
-        else
-        {
-            handler->PSendSysMessage("No psychologies found in the database.");
-        }
-        return true;
+        return GiveRandomTrait(handler, player, TraitKind::PSYCHOLOGY);
     }
 
-    // .rpg reload — reload psych, temperament, and character RPG data
+    // .rpg reload — reload psych, temperament, talent builds, stat weights and character RPG data
     static bool HandleRPGReloadCommand(ChatHandler* handler)
     {
-        // Count psych entries
-        QueryResult psychResult = CharacterDatabase.Query("SELECT COUNT(*) FROM rpgbots.rpg_psychology");
-        uint32 psychCount = psychResult ? (*psychResult)[0].Get<uint32>() : 0;
+        // Rebuild the trait library (and its samplers) from the DB
+        sTraitLibrary.Reload();
+        auto library = sTraitLibrary.Get();
+        uint32 psychCount = library->GetCount(TraitKind::PSYCHOLOGY);
+        uint32 tempCount  = library->GetCount(TraitKind::TEMPERAMENT);
 
-        // Count temperament entries
-        QueryResult tempResult = CharacterDatabase.Query("SELECT COUNT(*) FROM rpgbots.rpg_temperaments");
-        uint32 tempCount = tempResult ? (*tempResult)[0].Get<uint32>() : 0;
+        // Online characters pick up changed modifier rows immediately
+        sProfileStore.RecompileAll();
 
-        // Count character RPG data entries
-        QueryResult charResult = CharacterDatabase.Query("SELECT COUNT(*) FROM rpgbots.character_rpg_data");
-        uint32 charCount = charResult ? (*charResult)[0].Get<uint32>() : 0;
+        sBotTalentPlanner.LoadBuilds();
+        sBotItemScore.LoadWeights();   // also drops cached item scores
 
         handler->PSendSysMessage("|cff00ff00[RPG] Reload complete:|r");
         handler->PSendSysMessage("  Psychologies: |cffffd700{}|r", psychCount);
         handler->PSendSysMessage("  Temperaments: |cffffd700{}|r", tempCount);
-        handler->PSendSysMessage("  Character profiles: |cffffd700{}|r", charCount);
+        handler->PSendSysMessage("  Trait modifiers: |cffffd700{}|r", library->GetModifierCount());
+        handler->PSendSysMessage("  Talent builds: |cffffd700{}|r", sBotTalentPlanner.GetBuildCount());
+        handler->PSendSysMessage("  Stat weight rows: |cffffd700{}|r", sBotItemScore.GetWeightCount());
+        // Resident profiles only (online characters); no table scan
+        handler->PSendSysMessage("  Character profiles in memory: |cffffd700{}|r ({} dirty, {} loading)",
+            sProfileStore.GetResidentCount(), sProfileStore.GetDirtyCount(), sProfileStore.GetLoadingCount());
         return true;
     }
 };
@@ -0,0 +1,190 @@
+// RollEngine.cpp
+// Fixed-point RollSuccess tables and counter-based draws.  See RollEngine.h.
+
+#include "RollEngine.h"
+#include "RPGBotsConfig.h"
+#include "Chat.h"
+#include "CommandScript.h"
+#include "Player.h"
+#include "ScriptMgr.h"
+#include "Random.h"
+#include "Log.h"
+#include <algorithm>
+#include <bit>
+#include <iterator>
+
+using namespace Acore::ChatCommands;
+
+namespace
+{
+    // SplitMix64 finalizer — a full-avalanche mix of a 64-bit counter
+    inline uint64 Mix64(uint64 z)
+    {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    inline uint64 Draw(uint64 seed, ObjectGuid::LowType guid, uint32 counter)
+    {
+        return Mix64(seed ^ Mix64((uint64(guid) << 32) | counter));
+    }
+
+    // Probability in percent → P * 2^32, saturated
+    inline uint32 ToThreshold(float pct)
+    {
+        double p = std::clamp(double(pct) / 100.0, 0.0, 1.0);
+        return p >= 1.0 ? UINT32_MAX : uint32(p * 4294967296.0);
+    }
+
+    // Bucket index from the bits the compare does not use
+    inline uint8 MoodBucket(uint64 draw)
+    {
+        return uint8(draw >> 61);   // top 3 bits → 0..7
+    }
+
+    static_assert(ROLL_MOOD_BUCKETS == 8, "MoodBucket takes 3 bits");
+
+    char const* const STAT_NAMES[MAX_PROFILE_STATS] = { "Mechanics", "Rotation", "Heroism" };
+}
+
+void RollEngine::SetSeed(uint64 seed)
+{
+    _seed = seed ? seed : (uint64(urand(0, UINT32_MAX)) << 32) | urand(0, UINT32_MAX);
+}
+
+void RollEngine::Rebuild(ObjectGuid::LowType guid, RPGProfile const& profile, TraitModifiers const& mods)
+{
+    static_assert(sizeof(TraitModifiers::rollMult) / sizeof(float) == MAX_PROFILE_STATS, "rollMult is indexed by ProfileStat");
+
+    RollTable& table = _tables[guid];   // keeps the counter on a rebuild
+    for (uint8 s = 0; s < MAX_PROFILE_STATS; ++s)
+    {
+        float lo = mods.rollMult[s] * (1.0f - mods.moodSwing);
+        float hi = mods.rollMult[s] * (1.0f + mods.moodSwing);
+        for (uint8 b = 0; b < ROLL_MOOD_BUCKETS; ++b)
+        {
+            // Bucket centres spread evenly over [lo, hi]
+            float mult = lo + (hi - lo) * (b + 0.5f) / ROLL_MOOD_BUCKETS;
+            table.threshold[s][b] = ToThreshold(profile.stat[s] * mult + mods.rollOffset);
+        }
+    }
+}
+
+inline bool RollEngine::Roll(ObjectGuid::LowType guid, RollTable& table, ProfileStat stat)
+{
+    uint64 draw = Draw(_seed, guid, table.counter++);
+    return uint32(draw) < table.threshold[stat][MoodBucket(draw)];
+}
+
+bool RollEngine::RollSuccess(ObjectGuid::LowType guid, ProfileStat stat)
+{
+    auto it = _tables.find(guid);
+    if (it == _tables.end())
+        return true;
+
+    bool ok = Roll(guid, it->second, stat);
+    ++_rolls;
+    _successes += ok;
+    return ok;
+}
+
+uint64 RollEngine::RollGroup(ObjectGuid::LowType const* guids, uint32 count, ProfileStat stat)
+{
+    count = std::min(count, ROLL_MAX_GROUP);
+
+    uint64 mask = 0;
+    for (uint32 i = 0; i < count; ++i)
+    {
+        auto it = _tables.find(guids[i]);
+        bool ok = it == _tables.end() || Roll(guids[i], it->second, stat);
+        mask |= uint64(ok) << i;
+    }
+
+    _rolls += count;
+    _successes += uint64(std::popcount(mask));
+    return mask;
+}
+
+bool RollEngine::GetChanceRange(ObjectGuid::LowType guid, ProfileStat stat, float& minPct, float& maxPct) const
+{
+    auto it = _tables.find(guid);
+    if (it == _tables.end())
+        return false;
+
+    auto const& buckets = it->second.threshold[stat];
+    auto [lo, hi] = std::minmax_element(std::begin(buckets), std::end(buckets));
+    minPct = float(*lo / 4294967296.0 * 100.0);
+    maxPct = float(*hi / 4294967296.0 * 100.0);
+    return true;
+}
+
+// ─── World Script: seed from config ────────────────────────────────────────────
+class RollEngineWorldScript : public WorldScript
+{
+public:
+    RollEngineWorldScript() : WorldScript("RollEngineWorldScript") {}
+
+    void OnAfterConfigLoad(bool reload) override
+    {
+        // Reseeding mid-run would break reproducibility of a running session
+        if (reload)
+            return;
+
+        sRollEngine.SetSeed(RPGBotsConfig::RollSeed);
+        LOG_INFO("module", "RPGBots: Roll engine seeded with {}{}", sRollEngine.GetSeed(),
+            RPGBotsConfig::RollSeed ? "" : " (random)");
+    }
+};
+
+// ─── .rpg odds — effective RollSuccess chances ────────────────────────────────
+class RollEngineCommands : public CommandScript
+{
+public:
+    RollEngineCommands() : CommandScript("RollEngineCommands") {}
+
+    ChatCommandTable GetCommands() const override
+    {
+        static ChatCommandTable rpgTable =
+        {
+            { "odds", HandleOddsCmd, SEC_PLAYER, Console::No },
+        };
+        static ChatCommandTable topTable =
+        {
+            { "rpg", rpgTable },
+        };
+        return topTable;
+    }
+
+    static bool HandleOddsCmd(ChatHandler* handler)
+    {
+        Player* player = handler->GetSession()->GetPlayer();
+        if (!player)
+            return false;
+
+        ObjectGuid::LowType guid = player->GetGUID().GetCounter();
+        handler->PSendSysMessage("|cff00ff00[RPG] RollSuccess chances:|r");
+        for (uint8 s = 0; s < MAX_PROFILE_STATS; ++s)
+        {
+            float lo, hi;
+            if (!sRollEngine.GetChanceRange(guid, ProfileStat(s), lo, hi))
+            {
+                handler->PSendSysMessage("  No profile loaded.");
+                return true;
+            }
+            if (hi - lo < 0.05f)
+                handler->PSendSysMessage("  {}: |cffffd700{:.1f}%|r", STAT_NAMES[s], lo);
+            else
+                handler->PSendSysMessage("  {}: |cffffd700{:.1f}% – {:.1f}%|r", STAT_NAMES[s], lo, hi);
+        }
+        handler->PSendSysMessage("  Realm: {} table(s), {} roll(s), {} success(es)",
+            sRollEngine.GetTableCount(), sRollEngine.GetRolls(), sRollEngine.GetSuccesses());
+        return true;
+    }
+};
+
+void AddRollEngine()
+{
+    new RollEngineWorldScript();
+    new RollEngineCommands();
+}
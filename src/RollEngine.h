@@ -0,0 +1,77 @@
+// RollEngine.h
+// RollSuccess = Stat * Psych + Temp, precomputed per profile.
+//
+// Whenever a resident profile changes (load, create, reroll) its three stats
+// are turned into fixed-point thresholds: a roll is one 64-bit counter hash
+// and one integer compare, with no floating point on the hot path.
+//
+// Inputs come from the character's compiled TraitModifiers.  The multiplier
+// is a range rather than a constant (an Insane mood swing of 0.5 gives
+// 0.5x–1.5x), so each stat keeps ROLL_MOOD_BUCKETS thresholds spread across
+// that range; the high bits of the hash pick the bucket, the low 32 bits are
+// compared against it.  Reliable types have identical buckets.
+//
+// Draws come from a counter-based hash of (seed, guid, per-profile counter):
+// the same seed and the same call sequence give the same results.
+// RollGroup() rolls one stat for a whole army in a single pass and returns a
+// bitmask, which is how the AI consumes it.
+
+#pragma once
+
+#include "ProfileStore.h"
+#include <unordered_map>
+
+static constexpr uint8  ROLL_MOOD_BUCKETS = 8;
+static constexpr uint32 ROLL_MAX_GROUP    = 64;   // bits in a RollGroup mask
+
+class RollEngine
+{
+public:
+    static RollEngine& Instance()
+    {
+        static RollEngine instance;
+        return instance;
+    }
+
+    // 0 picks a random seed
+    void   SetSeed(uint64 seed);
+    uint64 GetSeed() const { return _seed; }
+
+    // Recompute thresholds (RPGProfileStore calls this on every profile change)
+    void Rebuild(ObjectGuid::LowType guid, RPGProfile const& profile, TraitModifiers const& mods);
+    void Forget(ObjectGuid::LowType guid) { _tables.erase(guid); }
+
+    // Characters without a table (psych system off, still loading) succeed
+    bool RollSuccess(ObjectGuid::LowType guid, ProfileStat stat);
+
+    // Bit i set = guids[i] succeeded.  count is capped at ROLL_MAX_GROUP.
+    uint64 RollGroup(ObjectGuid::LowType const* guids, uint32 count, ProfileStat stat);
+
+    // Effective chance range in percent (for display)
+    bool GetChanceRange(ObjectGuid::LowType guid, ProfileStat stat, float& minPct, float& maxPct) const;
+
+    uint32 GetTableCount() const { return uint32(_tables.size()); }
+    uint64 GetRolls()      const { return _rolls; }
+    uint64 GetSuccesses()  const { return _successes; }
+
+private:
+    RollEngine() = default;
+
+    struct RollTable
+    {
+        uint32 threshold[MAX_PROFILE_STATS][ROLL_MOOD_BUCKETS];   // P * 2^32
+        uint32 counter = 0;
+    };
+
+    bool Roll(ObjectGuid::LowType guid, RollTable& table, ProfileStat stat);
+
+    std::unordered_map<ObjectGuid::LowType, RollTable> _tables;
+    uint64 _seed      = 0;
+    uint64 _rolls     = 0;
+    uint64 _successes = 0;
+};
+
+#define sRollEngine RollEngine::Instance()
+
+// Registration
+void AddRollEngine();
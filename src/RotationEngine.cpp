@@ -3,7 +3,7 @@
 
 #include "RotationEngine.h"
 #include "ScriptMgr.h"
-#include "DatabaseEnv.h"
+#include "RPGBotsDatabase.h"
 #include "Log.h"
 
 namespace
@@ -50,16 +50,9 @@ uint32 RotationEngine::LoadFromDB()
 {
     _rotations.clear();
 
-    //  SELECT mirrors the column order in the CREATE TABLE
-    QueryResult result = CharacterDatabase.Query(
-        "SELECT class_id, spec_index, spec_name, role, preferred_range, "
-        "       ability_1, ability_2, ability_3, ability_4, ability_5, "
-        "       buff_1, buff_2, buff_3, buff_4, buff_5, "
-        "       defensive_1, defensive_2, defensive_3, defensive_4, defensive_5, "
-        "       dot_1, dot_2, dot_3, dot_4, dot_5, "
-        "       hot_1, hot_2, hot_3, hot_4, hot_5, "
-        "       mobility_1, mobility_2, mobility_3, mobility_4, mobility_5 "
-        "FROM rpgbots.bot_rotations");
+    //  Column order: see RPGBOTS_SEL_BOT_ROTATIONS (mirrors the CREATE TABLE)
+    PreparedQueryResult result = RPGBotsDatabase.Query(
+        RPGBotsDatabase.GetPreparedStatement(RPGBOTS_SEL_BOT_ROTATIONS));
 
     if (!result)
     {
@@ -15,6 +15,7 @@
 #include "ScriptMgr.h"
 #include "Player.h"
 #include "BotAI.h"
+#include "BotTickBudget.h"
 #include "RotationEngine.h"
 #include "RPGBotsConfig.h"
 #include "SelfBotSystem.h"
@@ -27,6 +28,7 @@
 #include "ObjectAccessor.h"
 #include "Log.h"
 #include "Group.h"
+#include "Timer.h"
 #include <unordered_map>
 #include <unordered_set>
 
@@ -455,17 +457,25 @@ public:
 
     void OnUpdate(uint32 diff) override
     {
+        // 1 second tick, shared with the army AI under one tick budget
         _timer += diff;
-        if (_timer < 1000) return;  // 1 second tick
-        _timer = 0;
-
-        if (sSelfBotPlayers.empty()) return;
+        if (_timer >= 1000)
+        {
+            _timer = 0;
+            _queue.Refill(sSelfBotPlayers, getMSTime());
+        }
 
-        // Iterate a copy of keys in case we need to remove
+        // Collect removals; erasing would invalidate the lookups below
         std::vector<ObjectGuid::LowType> toRemove;
 
-        for (auto& [guidLow, state] : sSelfBotPlayers)
+        ObjectGuid::LowType guidLow;
+        while (_queue.Next(guidLow))
         {
+            auto stateIt = sSelfBotPlayers.find(guidLow);
+            if (stateIt == sSelfBotPlayers.end()) continue;   // disabled while queued
+            SelfBotState& state = stateIt->second;
+
+            BotBudgetCharge charge;
             ObjectGuid guid = ObjectGuid::Create<HighGuid::Player>(guidLow);
             Player* player = ObjectAccessor::FindPlayer(guid);
             if (!player || !player->IsInWorld() || !player->IsAlive())
@@ -548,6 +558,7 @@ public:
 
 private:
     uint32 _timer = 0;
+    BotTickQueue _queue;   // selfbot players due, in round-robin order
 };
 
 // ─── Player logout cleanup ─────────────────────────────────────────────────────
@@ -0,0 +1,246 @@
+// TraitLibrary.cpp
+// Trait library load, rarity weights and alias sampling.  See TraitLibrary.h.
+
+#include "TraitLibrary.h"
+#include "RPGBotsDatabase.h"
+#include "Player.h"
+#include "SpellAuras.h"
+#include "Random.h"
+#include "Log.h"
+#include <algorithm>
+#include <cctype>
+
+namespace
+{
+    // Relative roll weight per rarity tier
+    static constexpr double RARITY_WEIGHTS[uint8(TraitRarity::MAX)] =
+    {
+        50.0,   // Common
+        25.0,   // Uncommon
+        12.0,   // Rare
+         8.0,   // Epic
+         4.0,   // Legendary
+         1.0,   // Ancient
+    };
+
+    TraitRarity RarityFromString(std::string const& s)
+    {
+        for (uint8 i = 0; i < uint8(TraitRarity::MAX); ++i)
+        {
+            std::string name = TraitRarityName(TraitRarity(i));
+            if (s.size() == name.size()
+                && std::equal(s.begin(), s.end(), name.begin(),
+                    [](char a, char b) { return std::tolower(uint8(a)) == std::tolower(uint8(b)); }))
+                return TraitRarity(i);
+        }
+        return TraitRarity::MAX;
+    }
+}
+
+char const* TraitRarityName(TraitRarity rarity)
+{
+    switch (rarity)
+    {
+        case TraitRarity::COMMON:    return "Common";
+        case TraitRarity::UNCOMMON:  return "Uncommon";
+        case TraitRarity::RARE:      return "Rare";
+        case TraitRarity::EPIC:      return "Epic";
+        case TraitRarity::LEGENDARY: return "Legendary";
+        case TraitRarity::ANCIENT:   return "Ancient";
+        default:                     return "Unknown";
+    }
+}
+
+// ─── Alias table ───────────────────────────────────────────────────────────────
+void AliasTable::Build(std::vector<double> const& weights)
+{
+    uint32 n = uint32(weights.size());
+    _prob.assign(n, 0.0);
+    _alias.assign(n, 0);
+    if (!n)
+        return;
+
+    double total = 0.0;
+    for (double w : weights)
+        total += w;
+
+    // Scale so the average column holds exactly 1.0
+    std::vector<double> scaled(n);
+    std::vector<uint32> small, large;
+    for (uint32 i = 0; i < n; ++i)
+    {
+        scaled[i] = total > 0.0 ? weights[i] * n / total : 1.0;
+        (scaled[i] < 1.0 ? small : large).push_back(i);
+    }
+
+    while (!small.empty() && !large.empty())
+    {
+        uint32 s = small.back(); small.pop_back();
+        uint32 l = large.back(); large.pop_back();
+
+        _prob[s]  = scaled[s];
+        _alias[s] = l;
+
+        scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+        (scaled[l] < 1.0 ? small : large).push_back(l);
+    }
+
+    // Leftovers are 1.0 up to rounding
+    for (uint32 i : large)
+        _prob[i] = 1.0;
+    for (uint32 i : small)
+        _prob[i] = 1.0;
+}
+
+uint32 AliasTable::Sample() const
+{
+    uint32 column = urand(0, uint32(_prob.size()) - 1);
+    return rand_norm() < _prob[column] ? column : _alias[column];
+}
+
+// ─── Library ───────────────────────────────────────────────────────────────────
+std::shared_ptr<TraitLibrary const> TraitLibrary::Load()
+{
+    auto lib = std::make_shared<TraitLibrary>();
+
+    static constexpr RPGBotsDatabaseStatements statements[uint8(TraitKind::MAX)] =
+    {
+        RPGBOTS_SEL_TEMPERAMENTS,
+        RPGBOTS_SEL_PSYCHOLOGIES,
+    };
+
+    for (uint8 k = 0; k < uint8(TraitKind::MAX); ++k)
+    {
+        auto& entries = lib->_entries[k];
+        if (PreparedQueryResult result = RPGBotsDatabase.Query(RPGBotsDatabase.GetPreparedStatement(statements[k])))
+        {
+            entries.reserve(result->GetRowCount());
+            do {
+                Field* fields = result->Fetch();
+                TraitEntry entry;
+                entry.id     = fields[0].Get<uint32>();
+                entry.name   = fields[1].Get<std::string>();
+                entry.rarity = RarityFromString(fields[2].Get<std::string>());
+                entry.auraId = fields[3].Get<uint32>();
+
+                if (entry.rarity == TraitRarity::MAX)
+                {
+                    LOG_WARN("module", "RPGBots: Trait {} ({}) has unknown rarity '{}', treating as Common",
+                        entry.id, entry.name, fields[2].Get<std::string>());
+                    entry.rarity = TraitRarity::COMMON;
+                }
+                entries.push_back(std::move(entry));
+            } while (result->NextRow());
+        }
+
+        std::vector<double> weights;
+        weights.reserve(entries.size());
+        for (uint32 i = 0; i < entries.size(); ++i)
+        {
+            TraitEntry const& entry = entries[i];
+            lib->_index[k][entry.id] = i;
+            weights.push_back(RARITY_WEIGHTS[uint8(entry.rarity)]);
+            if (entry.auraId)
+            {
+                lib->_kindAuraIds[k].insert(entry.auraId);
+                lib->_auraIds.insert(entry.auraId);
+            }
+        }
+        lib->_sampler[k].Build(weights);
+    }
+
+    // Modifier rows attach to entries loaded above
+    if (PreparedQueryResult result = RPGBotsDatabase.Query(RPGBotsDatabase.GetPreparedStatement(RPGBOTS_SEL_TRAIT_MODIFIERS)))
+    {
+        do {
+            Field* fields = result->Fetch();
+            uint8  kind = fields[0].Get<uint8>();
+            uint32 id   = fields[1].Get<uint32>();
+            if (kind >= uint8(TraitKind::MAX))
+                continue;
+
+            auto it = lib->_index[kind].find(id);
+            if (it == lib->_index[kind].end())
+            {
+                LOG_WARN("module", "RPGBots: rpg_trait_modifiers row ({}, {}) has no trait, skipped", kind, id);
+                continue;
+            }
+
+            TraitModifiers& mods = lib->_entries[kind][it->second].modifiers;
+            for (uint8 s = 0; s < MAX_PROFILE_STATS; ++s)
+                mods.rollMult[s]     = fields[2 + s].Get<float>();
+            mods.moodSwing           = fields[5].Get<float>();
+            mods.rollOffset          = fields[6].Get<float>();
+            mods.reactionDelayMs     = fields[7].Get<uint32>();
+            mods.defensiveHpOffset   = fields[8].Get<float>();
+            mods.healThresholdOffset = fields[9].Get<float>();
+            ++lib->_modifierCount;
+        } while (result->NextRow());
+    }
+
+    return lib;
+}
+
+TraitEntry const* TraitLibrary::Find(TraitKind kind, uint32 id) const
+{
+    auto const& index = _index[uint8(kind)];
+    auto it = index.find(id);
+    return it != index.end() ? &_entries[uint8(kind)][it->second] : nullptr;
+}
+
+TraitEntry const* TraitLibrary::Roll(TraitKind kind) const
+{
+    AliasTable const& sampler = _sampler[uint8(kind)];
+    if (sampler.Empty())
+        return nullptr;
+    return &_entries[uint8(kind)][sampler.Sample()];
+}
+
+TraitModifiers TraitLibrary::Compile(uint32 temperamentId, uint32 psychId) const
+{
+    TraitModifiers out;
+    for (TraitEntry const* entry : { Find(TraitKind::TEMPERAMENT, temperamentId),
+                                     Find(TraitKind::PSYCHOLOGY, psychId) })
+    {
+        if (!entry)
+            continue;
+
+        TraitModifiers const& m = entry->modifiers;
+        for (uint8 s = 0; s < MAX_PROFILE_STATS; ++s)
+            out.rollMult[s]     *= m.rollMult[s];
+        out.moodSwing           += m.moodSwing;
+        out.rollOffset          += m.rollOffset;
+        out.reactionDelayMs     += m.reactionDelayMs;
+        out.defensiveHpOffset   += m.defensiveHpOffset;
+        out.healThresholdOffset += m.healThresholdOffset;
+    }
+    out.moodSwing = std::clamp(out.moodSwing, 0.0f, 1.0f);
+    return out;
+}
+
+void TraitLibrary::RemoveTraitAuras(Player* player, TraitKind kind) const
+{
+    auto const& auraIds = _kindAuraIds[uint8(kind)];
+    if (auraIds.empty())
+        return;
+
+    // One pass over the player's own auras instead of one removal per trait row
+    player->RemoveAppliedAuras([&auraIds](AuraApplication const* aurApp)
+    {
+        return auraIds.count(aurApp->GetBase()->GetId()) > 0;
+    });
+}
+
+uint32 TraitLibrary::GetRarityCount(TraitKind kind, TraitRarity rarity) const
+{
+    return uint32(std::count_if(_entries[uint8(kind)].begin(), _entries[uint8(kind)].end(),
+        [rarity](TraitEntry const& e) { return e.rarity == rarity; }));
+}
+
+void TraitLibraryMgr::Reload()
+{
+    _library = TraitLibrary::Load();
+    LOG_INFO("module", "RPGBots: Trait library loaded: {} temperament(s), {} psychology type(s), {} modifier row(s)",
+        _library->GetCount(TraitKind::TEMPERAMENT), _library->GetCount(TraitKind::PSYCHOLOGY),
+        _library->GetModifierCount());
+}
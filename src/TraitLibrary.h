@@ -0,0 +1,140 @@
+// TraitLibrary.h
+// Immutable in-memory copy of rpg_temperaments / rpg_psychology.
+//
+// Loaded at startup and on `.rpg reload`; a reload builds a new library and
+// swaps it in, so holders of the previous shared_ptr keep a consistent view.
+// Each kind gets an alias-method table weighted by rarity, so a weighted
+// roll (new profiles, `.rpg temperament/psych`, the personality scroll) is
+// O(1): one uniform column pick plus one biased coin.  Randomness comes from
+// Random.h (thread-local SFMT), so rolls need no per-call generator setup.
+// The set of every trait aura id is precomputed for bulk removal.
+// rpg_trait_modifiers rows are attached to their entries, and Compile()
+// folds a temperament + psychology pair into one TraitModifiers block that
+// the AI and RollEngine read instead of probing trait auras.
+
+#pragma once
+
+#include "Define.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class Player;
+
+// Profile stats; TraitModifiers and RPGProfile (ProfileStore.h) are indexed by these
+enum ProfileStat : uint8
+{
+    PROFILE_STAT_MECHANICS = 0,
+    PROFILE_STAT_ROTATION  = 1,
+    PROFILE_STAT_HEROISM   = 2,
+    MAX_PROFILE_STATS
+};
+
+enum class TraitKind : uint8
+{
+    TEMPERAMENT = 0,
+    PSYCHOLOGY  = 1,
+    MAX
+};
+
+enum class TraitRarity : uint8
+{
+    COMMON,
+    UNCOMMON,
+    RARE,
+    EPIC,
+    LEGENDARY,
+    ANCIENT,
+    MAX
+};
+
+char const* TraitRarityName(TraitRarity rarity);
+
+// Behaviour modifiers; per trait row and, compiled, per character
+struct TraitModifiers
+{
+    float  rollMult[MAX_PROFILE_STATS] = { 1.0f, 1.0f, 1.0f };  // by ProfileStat
+    float  moodSwing           = 0.0f;   // ± fraction around rollMult
+    float  rollOffset          = 0.0f;   // % added after the multiplier
+    uint32 reactionDelayMs     = 0;
+    float  defensiveHpOffset   = 0.0f;   // added to the defensive HP% threshold
+    float  healThresholdOffset = 0.0f;   // added to the healer HP% threshold
+};
+
+struct TraitEntry
+{
+    uint32         id      = 0;
+    std::string    name;
+    TraitRarity    rarity  = TraitRarity::COMMON;
+    uint32         auraId  = 0;
+    TraitModifiers modifiers;
+};
+
+// Vose alias table over N weighted outcomes
+class AliasTable
+{
+public:
+    void   Build(std::vector<double> const& weights);
+    uint32 Sample() const;          // index into the weight vector
+    bool   Empty() const { return _prob.empty(); }
+
+private:
+    std::vector<double> _prob;
+    std::vector<uint32> _alias;
+};
+
+class TraitLibrary
+{
+public:
+    static std::shared_ptr<TraitLibrary const> Load();
+
+    std::vector<TraitEntry> const& GetAll(TraitKind kind) const { return _entries[uint8(kind)]; }
+    TraitEntry const* Find(TraitKind kind, uint32 id) const;
+
+    // Rarity-weighted roll (nullptr if the kind has no entries)
+    TraitEntry const* Roll(TraitKind kind) const;
+
+    // True for any temperament or psychology aura
+    bool IsTraitAura(uint32 auraId) const { return _auraIds.count(auraId) > 0; }
+
+    // Strip every aura of one kind from the player (no DB access)
+    void RemoveTraitAuras(Player* player, TraitKind kind) const;
+
+    // Temperament and psychology modifiers combined (unknown ids are neutral)
+    TraitModifiers Compile(uint32 temperamentId, uint32 psychId) const;
+
+    uint32 GetCount(TraitKind kind) const { return uint32(_entries[uint8(kind)].size()); }
+    uint32 GetRarityCount(TraitKind kind, TraitRarity rarity) const;
+    uint32 GetModifierCount() const { return _modifierCount; }
+
+private:
+    std::vector<TraitEntry>                  _entries[uint8(TraitKind::MAX)];
+    std::unordered_map<uint32, uint32>       _index[uint8(TraitKind::MAX)];    // id → entries idx
+    AliasTable                               _sampler[uint8(TraitKind::MAX)];
+    std::unordered_set<uint32>               _kindAuraIds[uint8(TraitKind::MAX)];
+    std::unordered_set<uint32>               _auraIds;
+    uint32                                   _modifierCount = 0;
+};
+
+class TraitLibraryMgr
+{
+public:
+    static TraitLibraryMgr& Instance()
+    {
+        static TraitLibraryMgr instance;
+        return instance;
+    }
+
+    // Build a fresh library from the DB and swap it in
+    void Reload();
+
+    std::shared_ptr<TraitLibrary const> Get() const { return _library; }
+
+private:
+    TraitLibraryMgr() : _library(std::make_shared<TraitLibrary>()) {}
+    std::shared_ptr<TraitLibrary const> _library;
+};
+
+#define sTraitLibrary TraitLibraryMgr::Instance()
@@ -3,6 +3,8 @@
 #include "ScriptMgr.h"
 
 void AddRPGBotsConfig();
+void AddRPGBotsDatabase();
+void AddRPGBotsDatabaseShutdown();
 
 void Addmod_rpgbots_PersonalitySystem();
 
@@ -14,11 +16,24 @@ void AddCustomTemperament();
 void AddBotSessionSystem();
 
 void AddArmyOfAlts();
+void AddBotSpawnProcessor();
+void AddArmyRoster();
+void AddBotSaveScheduler();
+void AddBotOnlineTracker();
+void AddRPGProfileStore();
+void AddRollEngine();
 
 void AddRotationEngine();
+void AddBotTickBudget();
+void AddBotProfiler();
 void AddBotAI();
+void AddBotLod();
+void AddBotDecisionTrace();
 
+void AddBotTalentIndex();
+void AddBotTalentPlanner();
 void AddBotTalentSystem();
+void AddBotItemScore();
 void AddBotEquipSystem();
 void AddSelfBotSystem();
 
@@ -27,6 +42,9 @@ void Addmod_rpgbotsScripts()
     // Config — must be first so all other systems can read config values
     AddRPGBotsConfig();
 
+    // rpgbots database pool — opened right after config, before any loader
+    AddRPGBotsDatabase();
+
     // Rotation Engine — loads SQL rotation data at startup
     AddRotationEngine();
 
@@ -36,14 +54,32 @@ void Addmod_rpgbotsScripts()
     AddCustomTemperament();
     AddBotSessionSystem();
     AddArmyOfAlts();
+    AddBotSpawnProcessor();
+    AddArmyRoster();          // restores armies through the spawn queue
+
+    // Batched bot persistence (dirty flags + interval flush, online flags)
+    AddBotSaveScheduler();
+    AddBotOnlineTracker();
+    AddRPGProfileStore();
+    AddRollEngine();
 
     // Bot AI — follow, assist, combat (must be after ArmyOfAlts)
+    AddBotTickBudget();       // opens each tick's budget before the AI scripts
+    AddBotProfiler();
     AddBotAI();
+    AddBotLod();
+    AddBotDecisionTrace();
 
     // Talent & Equipment management
+    AddBotTalentIndex();
+    AddBotTalentPlanner();
     AddBotTalentSystem();
+    AddBotItemScore();
     AddBotEquipSystem();
 
     // Selfbot — autoplay mode
     AddSelfBotSystem();
+
+    // Closes the rpgbots pool — must be last so every OnShutdown flush lands
+    AddRPGBotsDatabaseShutdown();
 }